@@ -175,12 +175,11 @@ namespace backend {
 		 * The method is processing the given program and producing some implementation
 		 * specific target code. Multiple (parallel) invocations of this function have to
 		 * be supported.
+		 *
+		 * If a cache directory has been specified using the INSIEME_CACHE_DIR environment
+		 * variable, the target code of previously converted programs is reused.
 		 */
-		TargetCodePtr convert(const core::NodePtr& program) const {
-			Converter converter = buildConverter(program->getNodeManager());
-			installAddons(converter);
-			return converter.convert(program);
-		}
+		TargetCodePtr convert(const core::NodePtr& program) const;
 
 		/**
 		 * Obtains mutable access to this backend's configuration.
@@ -206,6 +205,14 @@ namespace backend {
 		 */
 		virtual Converter buildConverter(core::NodeManager& manager) const = 0;
 
+		/**
+		 * Determines whether the target code produced by this backend only depends on the converted
+		 * program, the installed Add-Ons and the configuration, and may thus be cached.
+		 */
+		virtual bool isCacheable() const {
+			return true;
+		}
+
 	  private:
 		/**
 		 * Installs all Add-Ons defined for this backend instance within the given converter.
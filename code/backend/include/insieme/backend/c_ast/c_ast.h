@@ -43,6 +43,7 @@
 #include <cassert>
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include <boost/utility.hpp>
 
@@ -76,7 +77,7 @@ namespace c_ast {
 		/**
 		 * A static generator for generating equality class IDs
 		 */
-		static utils::SimpleIDGenerator<EqualityID> equalityClassIDGenerator;
+		static utils::ConcurrentIDGenerator<EqualityID> equalityClassIDGenerator;
 
 		/**
 		 * The ID of the equality class of this node. This ID is used to significantly
@@ -785,6 +786,11 @@ namespace c_ast {
 		vector<NodePtr> nodes;
 		std::map<string, IdentifierPtr> identMap;
 
+		/**
+		 * Nodes may be created concurrently, e.g. by the printer while printing fragments in parallel.
+		 */
+		std::mutex mutex;
+
 	  public:
 		CNodeManager() : nodes(), identMap() {}
 
@@ -800,6 +806,7 @@ namespace c_ast {
 		Ptr<T> create(Args... args) {
 			T* res = new T(args...);
 			res->setManager(this);
+			std::lock_guard<std::mutex> lock(mutex);
 			nodes.push_back(res);
 			return res;
 		}
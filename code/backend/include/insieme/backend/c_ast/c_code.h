@@ -38,6 +38,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <set>
 
@@ -69,6 +70,11 @@ namespace backend {
 
 			vector<CodeFragment*> fragments;
 
+			/**
+			 * Fragments may be created concurrently, e.g. by post-processors running in parallel.
+			 */
+			std::mutex mutex;
+
 			/**
 			 * A list of special, named code fragments which can be accessed
 			 * via their names. All fragments within this map have to be part
@@ -84,7 +90,9 @@ namespace backend {
 			template <typename T, typename... E>
 			Ptr<T> create(E... args) {
 				T* res = new T(args...);
+				std::lock_guard<std::mutex> lock(mutex);
 				fragments.push_back(res);
+				res->creationIndex = fragments.size();
 				return Ptr<T>(res);
 			}
 
@@ -110,6 +118,21 @@ namespace backend {
 		};
 
 
+		/**
+		 * The code of a C program split into a shared header and a list of translation units including it.
+		 */
+		struct TranslationUnits {
+			/**
+			 * The code shared by all translation units (includes, types, declarations).
+			 */
+			string header;
+
+			/**
+			 * The code of the individual translation units.
+			 */
+			vector<string> units;
+		};
+
 		/**
 		 * A class representing a C based target code.
 		 */
@@ -168,6 +191,19 @@ namespace backend {
 			 * List of fragments which compose this code
 			 */
 			const vector<CodeFragmentPtr>& getFragments() const { return fragments; }
+
+			/**
+			 * Splits this code into a shared header and up to the given number of translation units which may be
+			 * compiled independently and linked afterwards. The header covers all fragments which may be repeated
+			 * within every unit (types, prototypes, static or inline functions). Function definitions only depending
+			 * on the header are distributed among the units. All remaining fragments (e.g. global variables or tables)
+			 * as well as the fragments they depend on are kept within the first unit.
+			 *
+			 * @param numUnits the maximum number of translation units to be produced
+			 * @param headerName the name of the header file to be included by the translation units
+			 * @return the resulting header and the non-empty translation units, the first unit is always present
+			 */
+			TranslationUnits toTranslationUnits(unsigned numUnits, const string& headerName) const;
 		};
 
 		/**
@@ -192,6 +228,13 @@ namespace backend {
 			 */
 			std::set<string> includes;
 
+			/**
+			 * The position of this fragment within the creation order of its manager, starting at 1.
+			 */
+			std::size_t creationIndex = 0;
+
+			friend class CodeFragmentManager;
+
 		  public:
 			/**
 			 * A default constructor creating a code fragment without any dependencies.
@@ -310,6 +353,13 @@ namespace backend {
 				return includes;
 			};
 
+			/**
+			 * Obtains the position of this fragment within the creation order of its manager.
+			 */
+			std::size_t getCreationIndex() const {
+				return creationIndex;
+			}
+
 			/**
 			 * Add a new include file to the set of required includes.
 			 *
@@ -453,6 +503,15 @@ namespace backend {
 		 */
 		vector<CodeFragmentPtr> getOrderedClosure(const vector<CodeFragmentPtr>& fragments);
 
+		/**
+		 * Prints the given list of code fragments to the given stream, in the given order. Large lists
+		 * are printed in parallel, hence printing a fragment must not modify any shared state.
+		 *
+		 * @param out the stream to be printed to
+		 * @param fragments the fragments to be printed
+		 */
+		void printFragments(std::ostream& out, const vector<CodeFragmentPtr>& fragments);
+
 
 		/**
 		 * A special kind of code fragment used for aggregating dependencies. This code fragment will
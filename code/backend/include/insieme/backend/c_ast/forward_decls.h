@@ -86,7 +86,15 @@ namespace c_ast {
 	class IncludeFragment;
 	typedef Ptr<IncludeFragment> IncludeFragmentPtr;
 
-	typedef std::set<CodeFragmentPtr> FragmentSet;
+	/**
+	 * Orders code fragments by the order of their creation, such that sets of fragments are
+	 * enumerated in the same order independent of the memory locations of their elements.
+	 */
+	struct fragment_creation_order {
+		bool operator()(const CodeFragmentPtr& a, const CodeFragmentPtr& b) const;
+	};
+
+	typedef std::set<CodeFragmentPtr, fragment_creation_order> FragmentSet;
 
 } // end namespace c_ast
 } // end namespace backend
@@ -73,6 +73,11 @@ namespace opencl {
 
 	  protected:
 		virtual Converter buildConverter(core::NodeManager& manager) const;
+
+		// the produced kernel code depends on the step context
+		virtual bool isCacheable() const {
+			return false;
+		}
 	};
 
 } // end namespace opencl
@@ -95,7 +95,8 @@ namespace backend {
 
 	/**
 	 * Applies the given post-processor on the given list of fragments. This will alter
-	 * the given fragments.
+	 * the given fragments. Large lists of fragments are processed in parallel, hence
+	 * post-processors must not modify any state shared among fragments.
 	 *
 	 * @param converter the converter to access backend facilities (i.e. the CNodeManager to create new node instances)
 	 * @param processor the post-processor to be applied on the given fragments.
@@ -37,6 +37,16 @@
 
 #include "insieme/backend/backend.h"
 
+#include <sstream>
+#include <typeinfo>
+
+#include <boost/optional.hpp>
+
+#include "insieme/core/dump/binary_dump.h"
+
+#include "insieme/utils/disk_cache.h"
+#include "insieme/utils/version.h"
+
 #include "insieme/backend/addons/asm_stmt.h"
 #include "insieme/backend/addons/comma_operator.h"
 #include "insieme/backend/addons/complex_type.h"
@@ -53,6 +63,58 @@
 namespace insieme {
 namespace backend {
 
+	namespace {
+
+		/**
+		 * The target code restored from the cache, represented by its textual form.
+		 */
+		class CachedTargetCode : public TargetCode {
+			std::string code;
+
+		  public:
+			CachedTargetCode(const core::NodePtr& source, const std::string& code) : TargetCode(source), code(code) {}
+
+			virtual std::ostream& printTo(std::ostream& out) const {
+				return out << code;
+			}
+		};
+
+	}
+
+	TargetCodePtr Backend::convert(const core::NodePtr& program) const {
+		// check whether the target code may be obtained from the cache
+		auto cache = utils::cache::DiskCache::getDefault();
+		if(!cache || !isCacheable() || !config->dumpOclKernel.empty()) {
+			Converter converter = buildConverter(program->getNodeManager());
+			installAddons(converter);
+			return converter.convert(program);
+		}
+
+		// the key covers the backend setup and the full program, including its annotations
+		std::stringstream key;
+		key << "backend\n" << utils::getVersion() << "\n" << typeid(*this).name() << "\n";
+		for(const auto& cur : addons) {
+			const auto& addon = *cur;
+			key << "addon:" << typeid(addon).name() << "\n";
+		}
+		key << "main:" << config->mainFunctionName << "\n";
+		for(const auto& cur : config->additionalHeaderFiles) { key << "header:" << cur << "\n"; }
+		key << "instrument:" << config->instrumentMainFunction << "\n";
+		key << "comments:" << config->addIRCodeAsComment << "\n";
+		key << "hash:" << program->getNodeHashValue() << "\n";
+		std::stringstream ir(std::ios_base::out | std::ios_base::in | std::ios_base::binary);
+		core::dump::binary::dumpCompactIR(ir, program);
+		key << "ir:" << utils::cache::DiskCache::getDigest(ir.str()) << "\n";
+
+		if(auto code = cache->lookup(key.str())) { return std::make_shared<CachedTargetCode>(program, *code); }
+
+		Converter converter = buildConverter(program->getNodeManager());
+		installAddons(converter);
+		auto res = converter.convert(program);
+		cache->store(key.str(), toString(*res));
+		return res;
+	}
+
 	void Backend::addDefaultAddons() {
 		addAddOn<addons::StdInitListAddon>(); // this will reduce the resulting IR, so it might be good to do it early
 		addAddOn<addons::PointerType>();
@@ -53,6 +53,7 @@ namespace c_ast {
 
 
 	IdentifierPtr CNodeManager::create(const string& name) {
+		std::lock_guard<std::mutex> lock(mutex);
 		auto pos = identMap.find(name);
 		if(pos != identMap.end()) { return pos->second; }
 
@@ -65,7 +66,7 @@ namespace c_ast {
 	/**
 	 * Defining the equality ID generator.
 	 */
-	utils::SimpleIDGenerator<Node::EqualityID> Node::equalityClassIDGenerator;
+	utils::ConcurrentIDGenerator<Node::EqualityID> Node::equalityClassIDGenerator;
 
 
 	bool Node::operator==(const Node& other) const {
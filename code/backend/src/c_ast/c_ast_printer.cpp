@@ -69,6 +69,11 @@ namespace c_ast {
 			string indentStep;
 			int indent = 0;
 
+			/**
+			 * The line break followed by the current indentation, maintained along with the indent.
+			 */
+			string lineBreak = "\n";
+
 		  public:
 			CPrinter(const string& indentStep = "    ") : indentStep(indentStep) {}
 
@@ -101,16 +106,18 @@ namespace c_ast {
 			}
 
 			std::ostream& newLine(std::ostream& out) {
-				return out << "\n" << times(indentStep, indent);
+				return out << lineBreak;
 			}
 
 			void incIndent() {
 				indent++;
+				lineBreak += indentStep;
 			}
 
 			void decIndent() {
 				indent--;
 				assert_ge(indent, 0) << "Should never become < 0";
+				lineBreak.resize(lineBreak.size() - indentStep.size());
 			}
 
 			#define PRINT(name) std::ostream& print##name(name##Ptr node, std::ostream& out)
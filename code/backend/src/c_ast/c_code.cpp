@@ -38,6 +38,8 @@
 #include "insieme/backend/c_ast/c_code.h"
 
 #include <fstream>
+#include <sstream>
+#include <thread>
 
 #include <boost/graph/topological_sort.hpp>
 #include <boost/graph/adjacency_list.hpp>
@@ -62,46 +64,52 @@ namespace c_ast {
 	CCode::CCode(const SharedCodeFragmentManager& manager, const core::NodePtr& source, const vector<CodeFragmentPtr>& fragments)
 	    : TargetCode(source), fragmentManager(manager), fragments(fragments) {}
 
-	std::ostream& CCode::printTo(std::ostream& out) const {
-		// print a header
-		out << "/**\n";
-		out << " * ------------------------ Auto-generated Code ------------------------ \n";
-		out << " *           This code was generated by the Insieme Compiler \n";
-		out << " * --------------------------------------------------------------------- \n";
-		out << " */\n";
-
-		// collect and add includes
-		std::set<string> includes;
-		for_each(fragments, [&](const CodeFragmentPtr& cur) { includes.insert(cur->getIncludes().begin(), cur->getIncludes().end()); });
-		for_each(includes, [&](const string& cur) {
-			if(cur.empty()) { return; }
-			if(cur[0] == '<' || cur[0] == '"') {
-				out << "#include " << cur << "\n";
-			} else {
-				out << "#include <" << cur << ">\n";
-			}
-		});
+	namespace {
 
-		out << "\n";
+		/**
+		 * Prints the common prelude of generated code files, consisting of a header comment, the includes
+		 * requested by the given fragments and the macros utilized by the generated code.
+		 */
+		void printPrelude(std::ostream& out, const vector<CodeFragmentPtr>& fragments) {
+			// print a header
+			out << "/**\n";
+			out << " * ------------------------ Auto-generated Code ------------------------ \n";
+			out << " *           This code was generated by the Insieme Compiler \n";
+			out << " * --------------------------------------------------------------------- \n";
+			out << " */\n";
+
+			// collect and add includes
+			std::set<string> includes;
+			for_each(fragments, [&](const CodeFragmentPtr& cur) { includes.insert(cur->getIncludes().begin(), cur->getIncludes().end()); });
+			for_each(includes, [&](const string& cur) {
+				if(cur.empty()) { return; }
+				if(cur[0] == '<' || cur[0] == '"') {
+					out << "#include " << cur << "\n";
+				} else {
+					out << "#include <" << cur << ">\n";
+				}
+			});
 
-		// print macro definition for unified C/C++ compound initialization
-		out << "#ifdef __cplusplus\n"
-			<< "#define INS_INIT(...) __VA_ARGS__\n"
-			<< "#else\n"
-			<< "#define INS_INIT(...) (__VA_ARGS__)\n"
-			<< "#endif\n";
+			out << "\n";
 
-		// print macro definition for unified C/C++ in-place initialization
-		out << "#ifdef __cplusplus\n"
-			<< "#include <new>\n"
-			<< "#define INS_INPLACE_INIT(Loc,Type) new(Loc) Type\n"
-			<< "#else\n"
-			<< "#define INS_INPLACE_INIT(Loc,Type) *(Loc) = (Type)\n"
-			<< "#endif\n";
+			// print macro definition for unified C/C++ compound initialization
+			out << "#ifdef __cplusplus\n"
+				<< "#define INS_INIT(...) __VA_ARGS__\n"
+				<< "#else\n"
+				<< "#define INS_INIT(...) (__VA_ARGS__)\n"
+				<< "#endif\n";
 
+			// print macro definition for unified C/C++ in-place initialization
+			out << "#ifdef __cplusplus\n"
+				<< "#include <new>\n"
+				<< "#define INS_INPLACE_INIT(Loc,Type) new(Loc) Type\n"
+				<< "#else\n"
+				<< "#define INS_INPLACE_INIT(Loc,Type) *(Loc) = (Type)\n"
+				<< "#endif\n";
 
-		// print C++14 workaround
-		out << R"(#ifdef __cplusplus
+
+			// print C++14 workaround
+			out << R"(#ifdef __cplusplus
 				/** Workaround for libstdc++/libc bug.
 				 *  There's an inconsistency between libstdc++ and libc regarding whether
 				 *  ::gets is declared or not, which is only evident when using certain
@@ -110,15 +118,185 @@ namespace c_ast {
 				 */
 				#include <initializer_list>  // force libstdc++ to include its config
 				#undef _GLIBCXX_HAVE_GETS    // correct broken config)"
-			<< "\n#endif\n";
+				<< "\n#endif\n";
+		}
+
+	}
+
+	std::ostream& CCode::printTo(std::ostream& out) const {
+		printPrelude(out, fragments);
 
 		out << "\n/* ------- Program Code --------- */\n\n";
 
 		// print topological sorted list of fragments
-		for_each(fragments, [&out](const CodeFragmentPtr& cur) { out << *cur; });
+		printFragments(out, fragments);
 		return out << "\n";
 	}
 
+	namespace {
+
+		/**
+		 * Prints each of the given fragments into a string of its own. The fragments are independent of each
+		 * other, hence they are printed in parallel, interleaved among the available threads.
+		 */
+		vector<string> printEach(const vector<CodeFragmentPtr>& fragments) {
+			vector<string> code(fragments.size());
+			unsigned numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+			auto run = [&](unsigned first) {
+				std::stringstream buffer;
+				for(std::size_t i = first; i < fragments.size(); i += numThreads) {
+					buffer.str("");
+					buffer << *fragments[i];
+					code[i] = buffer.str();
+				}
+			};
+
+			// small programs are printed sequentially
+			if(numThreads == 1 || fragments.size() < 64) {
+				run(0);
+				return code;
+			}
+
+			vector<std::thread> threads;
+			for(unsigned i = 0; i < numThreads; i++) {
+				threads.emplace_back(run, i);
+			}
+			for(auto& cur : threads) {
+				cur.join();
+			}
+			return code;
+		}
+
+	}
+
+	void printFragments(std::ostream& out, const vector<CodeFragmentPtr>& fragments) {
+		// small programs are printed sequentially
+		if(fragments.size() < 64) {
+			for(const auto& cur : fragments) {
+				out << *cur;
+			}
+			return;
+		}
+
+		// concatenate the results in the topological order
+		for(const auto& cur : printEach(fragments)) {
+			out << cur;
+		}
+	}
+
+	namespace {
+
+		/**
+		 * The ways a fragment may be placed when splitting a code into multiple translation units.
+		 */
+		enum class Placement {
+			Header, // < the fragment may be repeated within every unit
+			Unit,   // < the fragment has to be defined once, but may be placed in any unit
+			Main    // < the fragment has to be placed in the main unit
+		};
+
+		bool isShareable(const NodePtr& node) {
+			switch(node->getType()) {
+			case NT_Comment:
+			case NT_TypeDeclaration:
+			case NT_TypeDefinition:
+			case NT_TypeAlias:
+			case NT_FunctionPrototype: return true;
+			case NT_GlobalVarDecl: return node.as<GlobalVarDeclPtr>()->external;
+			case NT_Function: return node.as<FunctionPtr>()->flags & (Function::STATIC | Function::INLINE);
+			default: return false;
+			}
+		}
+
+		bool isMovable(const NodePtr& node) {
+			return node->getType() == NT_Comment || (node->getType() == NT_Function && !isShareable(node));
+		}
+
+		Placement getPlacement(const CodeFragmentPtr& fragment) {
+			// fragments without code are only contributing includes
+			if(dynamic_pointer_cast<DummyFragment>(fragment) || dynamic_pointer_cast<IncludeFragment>(fragment)) { return Placement::Header; }
+
+			// the content of other fragments (e.g. runtime tables) is unknown
+			CCodeFragmentPtr code = dynamic_pointer_cast<CCodeFragment>(fragment);
+			if(!code) { return Placement::Main; }
+
+			if(all(code->getCode(), &isShareable)) { return Placement::Header; }
+			if(all(code->getCode(), &isMovable)) { return Placement::Unit; }
+			return Placement::Main;
+		}
+	}
+
+	TranslationUnits CCode::toTranslationUnits(unsigned numUnits, const string& headerName) const {
+		numUnits = std::max(numUnits, 1u);
+
+		// determine the placement of the fragments - fragments may only be shared or moved if all their dependencies are shared
+		std::map<const CodeFragment*, Placement> placement;
+		auto isShared = [&](const CodeFragmentPtr& dep) {
+			if(!dep) { return true; }
+			auto pos = placement.find(&*dep);
+			return pos == placement.end() || pos->second == Placement::Header;
+		};
+		for(const auto& cur : fragments) {
+			Placement res = getPlacement(cur);
+			if(res != Placement::Main && !all(cur->getDependencies(), isShared)) { res = Placement::Main; }
+			placement[&*cur] = res;
+		}
+
+		// function definitions required by the main unit have to be placed within the main unit too
+		for(auto it = fragments.rbegin(); it != fragments.rend(); ++it) {
+			if(placement[&**it] != Placement::Main) { continue; }
+			for(const auto& dep : (*it)->getDependencies()) {
+				if(!dep) { continue; }
+				auto pos = placement.find(&*dep);
+				if(pos != placement.end() && pos->second == Placement::Unit) { pos->second = Placement::Main; }
+			}
+		}
+
+		// print all fragments
+		vector<string> code = printEach(fragments);
+
+		// assign movable fragments to units - largest first, to the unit of the currently smallest size
+		vector<std::size_t> load(numUnits, 0);
+		vector<unsigned> unitOf(fragments.size(), 0);
+		vector<std::size_t> movable;
+		for(std::size_t i = 0; i < fragments.size(); i++) {
+			auto res = placement[&*fragments[i]];
+			if(res == Placement::Main) { load[0] += code[i].size(); }
+			if(res == Placement::Unit) { movable.push_back(i); }
+		}
+		std::stable_sort(movable.begin(), movable.end(), [&](std::size_t a, std::size_t b) { return code[a].size() > code[b].size(); });
+		for(std::size_t i : movable) {
+			unitOf[i] = std::min_element(load.begin(), load.end()) - load.begin();
+			load[unitOf[i]] += code[i].size();
+		}
+
+		// assemble the resulting header and units, each following the topological order of the fragments
+		std::stringstream header;
+		printPrelude(header, fragments);
+		header << "\n/* ------- Shared Declarations --------- */\n\n";
+
+		vector<std::stringstream> units(numUnits);
+		for(auto& cur : units) {
+			cur << "#include \"" << headerName << "\"\n";
+			cur << "\n/* ------- Program Code --------- */\n\n";
+		}
+
+		for(std::size_t i = 0; i < fragments.size(); i++) {
+			if(placement[&*fragments[i]] == Placement::Header) {
+				header << code[i];
+			} else {
+				units[unitOf[i]] << code[i];
+			}
+		}
+
+		TranslationUnits res;
+		res.header = header.str();
+		for(unsigned i = 0; i < numUnits; i++) {
+			if(i == 0 || load[i] > 0) { res.units.push_back(units[i].str() + "\n"); }
+		}
+		return res;
+	}
+
 	// -- Code Fragment Manager -------------------------------------------------
 
 	CodeFragmentManager::~CodeFragmentManager() {
@@ -128,6 +306,12 @@ namespace c_ast {
 
 	// -- Code Fragments -------------------------------------------------------
 
+	bool fragment_creation_order::operator()(const CodeFragmentPtr& a, const CodeFragmentPtr& b) const {
+		if(!a || !b) { return !a && b; }
+		if(a->getCreationIndex() != b->getCreationIndex()) { return a->getCreationIndex() < b->getCreationIndex(); }
+		return a.ptr < b.ptr;
+	}
+
 	CodeFragment::CodeFragment(const CodeFragment& other) : dependencies(other.dependencies), requirements(other.requirements), includes(other.includes) {
 		// check for cyclic dependencies
 		assert_true(!any(dependencies, [&](const CodeFragmentPtr& cur) -> bool { return cur->isDependingOn(this); })) << "Cyclic dependency formed!";
@@ -81,7 +81,7 @@ namespace backend {
 			<< "Errors introduced by backend pre-processors."
 			<< "Active backend Preprocessors: "<< *getPreProcessor() << std::endl;
 
-		timer.stop();
+		double preprocessingTime = timer.stop();
 		LOG(INFO) << timer;
 
 		// -------------------------- CONVERSION -------------------------
@@ -104,9 +104,16 @@ namespace backend {
 		fragment->addIncludes(context.getIncludes());
 		if(!config.additionalHeaderFiles.empty()) { fragment->addIncludes(config.additionalHeaderFiles); }
 
+		double conversionTime = timer.stop();
+		LOG(INFO) << timer;
+
+		// -------------------------- ORDERING ---------------------------
+
+		timer = insieme::utils::Timer(getConverterName() + " Fragment Ordering");
+
 		vector<c_ast::CodeFragmentPtr> fragments = c_ast::getOrderedClosure(toVector(fragment));
 
-		timer.stop();
+		double orderingTime = timer.stop();
 		LOG(INFO) << timer;
 
 		// ------------------------ POST-PROCESSING ----------------------
@@ -121,9 +128,13 @@ namespace backend {
 		// sort the fragments again, as the post-processing might have changed the dependencies
 		fragments = c_ast::getOrderedClosure(toVector(fragment));
 
-		timer.stop();
+		double postprocessingTime = timer.stop();
 		LOG(INFO) << timer;
 
+		// summarize the phases
+		LOG(INFO) << getConverterName() << " Phases: preprocessing " << preprocessingTime << " s, conversion " << conversionTime << " s, ordering "
+		          << orderingTime << " s, postprocessing " << postprocessingTime << " s - " << fragments.size() << " fragments";
+
 		// --------------------------- Finalize --------------------------
 
 		// create resulting code fragment
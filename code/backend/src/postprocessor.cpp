@@ -37,17 +37,39 @@
 
 #include "insieme/backend/postprocessor.h"
 
+#include <thread>
+
 #include "insieme/backend/c_ast/c_code.h"
 
 namespace insieme {
 namespace backend {
 
 	void applyToAll(const Converter& converter, const PostProcessorPtr& processor, vector<c_ast::CodeFragmentPtr>& fragments) {
-		// apply to all fragments ...
-		for_each(fragments, [&](const c_ast::CodeFragmentPtr& cur) {
-			// => test whether it is a C-code fragment
-			if(c_ast::CCodeFragmentPtr frag = dynamic_pointer_cast<c_ast::CCodeFragment>(cur)) { frag->apply(converter, processor); }
-		});
+		// collect the C-code fragments
+		vector<c_ast::CCodeFragmentPtr> code;
+		for(const auto& cur : fragments) {
+			if(c_ast::CCodeFragmentPtr frag = dynamic_pointer_cast<c_ast::CCodeFragment>(cur)) { code.push_back(frag); }
+		}
+
+		// fragments are processed independently - large lists are processed in parallel, interleaved among the threads
+		unsigned numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+		if(code.size() < 64) { numThreads = 1; }
+		auto run = [&](unsigned first) {
+			for(std::size_t i = first; i < code.size(); i += numThreads) {
+				code[i]->apply(converter, processor);
+			}
+		};
+		if(numThreads == 1) {
+			run(0);
+			return;
+		}
+		vector<std::thread> threads;
+		for(unsigned i = 0; i < numThreads; i++) {
+			threads.emplace_back(run, i);
+		}
+		for(auto& cur : threads) {
+			cur.join();
+		}
 	}
 
 
@@ -133,6 +133,100 @@ namespace c_ast {
 		EXPECT_TRUE(codeD->isDependingOn(codeX));
 	}
 
+	TEST(C_AST, DeterministicFragmentOrder) {
+		SharedCodeFragmentManager fragmentManager = CodeFragmentManager::createShared();
+
+		// create independent fragments - their order should follow the order of creation
+		vector<CodeFragmentPtr> fragments;
+		CodeFragmentPtr root = getTextFragment(fragmentManager, "R");
+		for(char c = 'a'; c <= 'z'; c++) {
+			fragments.push_back(getTextFragment(fragmentManager, string(1, c)));
+		}
+		for(auto it = fragments.rbegin(); it != fragments.rend(); ++it) {
+			root->addDependency(*it);
+		}
+
+		EXPECT_EQ(fragments.size(), root->getDependencies().size());
+		EXPECT_EQ(fragments, vector<CodeFragmentPtr>(root->getDependencies().begin(), root->getDependencies().end()));
+		EXPECT_PRED2(containsSubString, toString(CCode(fragmentManager, core::NodePtr(), root)), "abcdefghijklmnopqrstuvwxyzR");
+	}
+
+	TEST(C_AST, ParallelFragmentPrinting) {
+		SharedCodeFragmentManager fragmentManager = CodeFragmentManager::createShared();
+
+		// create a chain of fragments large enough to be printed in parallel
+		vector<CodeFragmentPtr> fragments;
+		string expected;
+		for(unsigned i = 0; i < 500; i++) {
+			fragments.push_back(getTextFragment(fragmentManager, format("f%d;", i)));
+			if(i > 0) { fragments[i]->addDependency(fragments[i - 1]); }
+			expected += format("f%d;", i);
+		}
+
+		// the output has to follow the topological order
+		std::stringstream out;
+		printFragments(out, fragments);
+		EXPECT_EQ(expected, out.str());
+		EXPECT_PRED2(containsSubString, toString(CCode(fragmentManager, core::NodePtr(), fragments.back())), expected);
+	}
+
+	TEST(C_AST, TranslationUnits) {
+		SharedCodeFragmentManager fragmentManager = CodeFragmentManager::createShared();
+		auto cManager = fragmentManager->getNodeManager();
+
+		auto intType = cManager->create(PrimitiveType::Int32);
+		auto function = [&](const string& name) {
+			return cManager->create<Function>(intType, cManager->create(name), cManager->create<Compound>());
+		};
+
+		// two functions with prototypes and definitions
+		auto f = function("f");
+		auto g = function("g");
+		auto protoF = CCodeFragment::createNew(fragmentManager, cManager->create<FunctionPrototype>(f));
+		auto protoG = CCodeFragment::createNew(fragmentManager, cManager->create<FunctionPrototype>(g));
+		auto defF = CCodeFragment::createNew(fragmentManager, f);
+		auto defG = CCodeFragment::createNew(fragmentManager, g);
+		defF->addDependency(protoF);
+		defG->addDependency(protoG);
+
+		// a global variable and a function using it
+		auto global = CCodeFragment::createNew(fragmentManager, cManager->create<GlobalVarDecl>(intType, "x", false));
+		auto defH = CCodeFragment::createNew(fragmentManager, function("h"));
+		defH->addDependency(global);
+
+		// a table depending on the definition of g
+		auto table = getTextFragment(fragmentManager, "TABLE");
+		table->addDependency(defG);
+
+		CCode code(fragmentManager, core::NodePtr(), getOrderedClosure(toVector<CodeFragmentPtr>(defF, defH, table)));
+		auto units = code.toTranslationUnits(3, "code.h");
+
+		// the header covers the prototypes only
+		EXPECT_PRED2(containsSubString, units.header, "int32_t f();");
+		EXPECT_PRED2(containsSubString, units.header, "int32_t g();");
+		EXPECT_PRED2(notContainsSubString, units.header, "int32_t x");
+		EXPECT_PRED2(notContainsSubString, units.header, "TABLE");
+
+		// the global variable, h, the table and the required definition of g are kept in the main unit, f is moved
+		ASSERT_EQ(2u, units.units.size());
+		EXPECT_PRED2(containsSubString, units.units[0], "#include \"code.h\"");
+		EXPECT_PRED2(containsSubString, units.units[0], "int32_t x;");
+		EXPECT_PRED2(containsSubString, units.units[0], "int32_t h()");
+		EXPECT_PRED2(containsSubString, units.units[0], "int32_t g()");
+		EXPECT_PRED2(containsSubString, units.units[0], "TABLE");
+		EXPECT_PRED2(notContainsSubString, units.units[0], "int32_t f()");
+
+		EXPECT_PRED2(containsSubString, units.units[1], "#include \"code.h\"");
+		EXPECT_PRED2(containsSubString, units.units[1], "int32_t f()");
+		EXPECT_PRED2(notContainsSubString, units.units[1], "int32_t h()");
+
+		// a single unit contains all the definitions
+		units = code.toTranslationUnits(1, "code.h");
+		ASSERT_EQ(1u, units.units.size());
+		EXPECT_PRED2(containsSubString, units.units[0], "int32_t f()");
+		EXPECT_PRED2(containsSubString, units.units[0], "int32_t h()");
+	}
+
 } // end namespace c_ast
 } // end namespace backend
 } // end namespace insieme
@@ -62,6 +62,9 @@
 // disable full semantic checks
 #define INSIEME_NO_SEMA "INSIEME_NO_SEMA"
 
+// number of threads utilized for running the full semantic checks
+#define INSIEME_SEMA_THREADS "INSIEME_SEMA_THREADS"
+
 // create JSON dumps for inspyer tool on semantic errors
 #define INSIEME_SEMA_INSPYER "INSIEME_SEMA_INSPYER"
 
@@ -96,5 +99,8 @@
 
 ///////////// DRIVER
 
+// the directory of the on-disk cache for frontend and backend results (disabled if not set)
+#define INSIEME_CACHE_DIR "INSIEME_CACHE_DIR"
+
 #define INSIEMECC_FLAGS "INSIEMECC_FLAGS"
 
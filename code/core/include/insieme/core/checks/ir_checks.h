@@ -95,6 +95,20 @@ namespace checks {
 
 	CheckPtr makeVisitOnce(const CheckPtr& check);
 
+	/**
+	 * Creates a check conducting the given check on every node once, like makeVisitOnce. Additionally,
+	 * shared sub-DAGs found to be free of issues are tagged, such that they are skipped when being
+	 * checked again by the same check instance (e.g. after a transformation replaced some other part).
+	 *
+	 * Since a node is only checked in the context it has been encountered first, the given check
+	 * should not depend on the context of the checked nodes.
+	 *
+	 * @param check the check to be conducted on all nodes
+	 * @param numThreads the number of threads to be used for checking nodes; this requires the check
+	 * 			to be safe for being run concurrently on different nodes
+	 */
+	CheckPtr makeMemoized(const CheckPtr& check, unsigned numThreads = 1);
+
 	CheckPtr combine(const CheckList& list);
 
 	template <typename... Checks>
@@ -38,6 +38,7 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
 
 #include "insieme/core/forward_decls.h"
 #include "insieme/core/ir_address.h"
@@ -58,6 +59,26 @@ namespace binary {
 	*/
 	const uint64_t MAGIC_NUMBER = 0x494e5350495245; // HEX version of INSPIRE
 
+	/**
+	* The magic number stored at the head of all indexed encodings.
+	*/
+	const uint64_t INDEXED_MAGIC_NUMBER = 0x494e5350495249; // HEX version of INSPIRI
+
+	/**
+	* The version of the indexed encoding, to be increased whenever the format is changing.
+	*/
+	const uint32_t INDEXED_FORMAT_VERSION = 1;
+
+	/**
+	* The magic number stored at the head of all compact encodings.
+	*/
+	const uint64_t COMPACT_MAGIC_NUMBER = 0x494e5350495243; // HEX version of INSPIRC
+
+	/**
+	* The version of the compact encoding, to be increased whenever the format is changing.
+	*/
+	const uint32_t COMPACT_FORMAT_VERSION = 1;
+
 	/**
 	 * Writes a binary encoding of the given IR node into the given output stream.
 	 *
@@ -88,9 +109,10 @@ namespace binary {
 	                   const AnnotationConverterRegister& converterRegister = AnnotationConverterRegister::getDefault());
 
 	/**
-	 * Restores an IR code fragment from the given input stream. For constructing
-	 * the resulting nodes, the given manager will be used. In case the stream contains
-	 * an illegal encoding, an InvalidEncodingException will be thrown.
+	 * Restores an IR code fragment from the given input stream, accepting the encodings
+	 * of dumpIR and dumpCompactIR. For constructing the resulting nodes, the given manager
+	 * will be used. In case the stream contains an illegal encoding, an InvalidEncodingException
+	 * will be thrown.
 	 *
 	 * @param in the stream to be reading from
 	 * @param manager the node manager to be used for creating nodes
@@ -127,6 +149,152 @@ namespace binary {
 	vector<NodeAddress> loadAddresses(std::istream& in, NodeManager& manager,
 	                                  const AnnotationConverterRegister& converterRegister = AnnotationConverterRegister::getDefault());
 
+	/**
+	 * Writes a compact binary encoding of the given IR node into the given output stream. The
+	 * encoding is produced while traversing the IR, using variable length integers, relative
+	 * child references and a shared table of strings. It may be restored using loadIR.
+	 *
+	 * @param out the stream to be writing to
+	 * @param ir the root node of the IR to be written
+	 * @param converterRegister the register of annotation converters to be used
+	 */
+	void dumpCompactIR(std::ostream& out, const NodePtr& ir,
+	                   const AnnotationConverterRegister& converterRegister = AnnotationConverterRegister::getDefault());
+
+	/**
+	 * Writes a binary encoding of the given list of root nodes into the given output stream.
+	 * Unlike the encoding produced by dumpIR, this encoding is including a table of node
+	 * offsets, enabling a LazyIRLoader to restore nodes on demand.
+	 *
+	 * @param out the stream to be writing to
+	 * @param roots the root nodes of the IR to be written
+	 * @param converterRegister the register of annotation converters to be used
+	 */
+	void dumpIndexedIR(std::ostream& out, const NodeList& roots,
+	                   const AnnotationConverterRegister& converterRegister = AnnotationConverterRegister::getDefault());
+
+	/**
+	 * Determines whether the given stream is positioned at the start of an indexed encoding.
+	 * The read position of the stream is not altered.
+	 *
+	 * @param in the stream to be checked
+	 * @return true if an indexed encoding is following, false otherwise
+	 */
+	bool isIndexedIR(std::istream& in);
+
+	/**
+	 * A loader restoring the nodes of an indexed encoding on demand. Only nodes reachable
+	 * from requested roots are materialized, together with the annotations attached to them.
+	 * Instances are not thread safe.
+	 */
+	class LazyIRLoader {
+		/**
+		 * Keeps the memory region holding the encoding alive.
+		 */
+		std::shared_ptr<const void> storage;
+
+		/**
+		 * The start of the encoding and its size.
+		 */
+		const char* data;
+		std::size_t size;
+
+		/**
+		 * The manager used to construct nodes.
+		 */
+		NodeManager& manager;
+
+		/**
+		 * The index of the converters used to restore the annotations as specified within the header.
+		 */
+		vector<AnnotationConverterPtr> converter_index;
+
+		/**
+		 * The indices of the root nodes.
+		 */
+		vector<uint32_t> roots;
+
+		/**
+		 * The start of the offset table within the encoding.
+		 */
+		const char* offsets;
+
+		/**
+		 * The nodes materialized so far.
+		 */
+		vector<NodePtr> index;
+
+		/**
+		 * The number of nodes materialized so far.
+		 */
+		std::size_t numMaterialized;
+
+	  public:
+		/**
+		 * Creates a loader operating on a copy of the given encoding.
+		 *
+		 * @param manager the node manager to be used for creating nodes
+		 * @param data the encoding produced by dumpIndexedIR
+		 * @param converterRegister the register of annotation converters to be used
+		 */
+		LazyIRLoader(NodeManager& manager, const std::string& data,
+		             const AnnotationConverterRegister& converterRegister = AnnotationConverterRegister::getDefault());
+
+		/**
+		 * Creates a loader operating on the encoding stored within the given file starting at the given
+		 * offset. The file is mapped into memory, such that only the pages of materialized nodes are read.
+		 * In case the file can not be mapped or contains an illegal encoding, an InvalidEncodingException
+		 * will be thrown.
+		 *
+		 * @param manager the node manager to be used for creating nodes
+		 * @param file the file to be mapped
+		 * @param offset the position of the encoding within the file
+		 * @param converterRegister the register of annotation converters to be used
+		 */
+		static std::unique_ptr<LazyIRLoader> mapFile(NodeManager& manager, const std::string& file, std::size_t offset = 0,
+		                                             const AnnotationConverterRegister& converterRegister = AnnotationConverterRegister::getDefault());
+
+		LazyIRLoader(const LazyIRLoader&) = delete;
+		LazyIRLoader& operator=(const LazyIRLoader&) = delete;
+
+		/**
+		 * Obtains the number of root nodes within the encoding.
+		 */
+		std::size_t getNumRoots() const {
+			return roots.size();
+		}
+
+		/**
+		 * Obtains the total number of nodes within the encoding.
+		 */
+		std::size_t getNumNodes() const {
+			return index.size();
+		}
+
+		/**
+		 * Obtains the number of nodes materialized so far.
+		 */
+		std::size_t getNumMaterializedNodes() const {
+			return numMaterialized;
+		}
+
+		/**
+		 * Obtains the requested root node, materializing the nodes reachable from it if necessary.
+		 *
+		 * @param i the index of the root node
+		 * @return the restored root node
+		 */
+		NodePtr getRoot(std::size_t i);
+
+	  private:
+		LazyIRLoader(NodeManager& manager, const std::shared_ptr<const std::string>& data, const AnnotationConverterRegister& converterRegister);
+
+		LazyIRLoader(NodeManager& manager, const std::shared_ptr<const void>& storage, const char* data, std::size_t size,
+		             const AnnotationConverterRegister& converterRegister);
+
+		NodePtr resolve(uint32_t pos);
+	};
+
 	/**
 	 * A wrapper to be streamed into an output stream when aiming on dumping some
 	 * code.
@@ -37,6 +37,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 
@@ -83,6 +84,23 @@ namespace utils {
 	*/
 	void dumpString(std::ostream& out, const std::string& str);
 
+	/**
+	* Writes an unsigned value LEB128 encoded to the given output stream, hence using
+	* 7 bits per byte and the highest bit to mark the presence of further bytes.
+	*
+	* @param out the stream to be writing to
+	* @param value the value to be written
+	*/
+	void writeVarint(std::ostream& out, uint64_t value);
+
+	/**
+	* Reads a LEB128 encoded unsigned value from the given input stream.
+	*
+	* @param in the stream to be reading from
+	* @return read value, 0 if the stream is exhausted
+	*/
+	uint64_t readVarint(std::istream& in);
+
 } // end namespace utils
 } // end namespace binary
 } // end namespace dump
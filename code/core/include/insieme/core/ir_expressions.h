@@ -111,7 +111,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static LiteralPtr get(NodeManager & manager, const TypePtr& type, const StringValuePtr& value) {
-			return manager.get(Literal(type, value));
+			return manager.getNode<Literal>(type, value);
 		}
 
 		/**
@@ -176,7 +176,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static VariablePtr get(NodeManager & manager, const TypePtr& type, const UIntValuePtr& id) {
-			return manager.get(Variable(type, id));
+			return manager.getNode<Variable>(type, id);
 		}
 
 		/**
@@ -335,7 +335,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static CastExprPtr get(NodeManager & manager, const TypePtr& type, const ExpressionPtr& value) {
-			return manager.get(CastExpr(type, value));
+			return manager.getNode<CastExpr>(type, value);
 		}
 
 	IR_NODE_END()
@@ -371,7 +371,7 @@ namespace core {
 		 * @return the requested instance managed by the given manager
 		 */
 		static ParametersPtr get(NodeManager & manager, const VariableList& parameter) {
-			return manager.get(Parameters(convertList(parameter)));
+			return manager.getNode<Parameters>(convertList(parameter));
 		}
 	IR_NODE_END()
 
@@ -505,7 +505,7 @@ namespace core {
 		  * @return the requested instance managed by the given manager
 		  */
 		  static LambdaReferencePtr get(NodeManager & manager, const FunctionTypePtr& type, const StringValuePtr& name) {
-			  return manager.get(LambdaReference(type, name));
+			  return manager.getNode<LambdaReference>(type, name);
 		  }
 
 		  /**
@@ -658,7 +658,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static LambdaExprPtr get(NodeManager & manager, const FunctionTypePtr& type, const LambdaReferencePtr& ref, const LambdaDefinitionPtr& definition) {
-			return manager.get(LambdaExpr(type, ref, definition));
+			return manager.getNode<LambdaExpr>(type, ref, definition);
 		}
 
 		/**
@@ -777,7 +777,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static LambdaBindingPtr get(NodeManager & manager, const LambdaReferencePtr& ref, const LambdaPtr& lambda) {
-			return manager.get(LambdaBinding(ref, lambda));
+			return manager.getNode<LambdaBinding>(ref, lambda);
 		}
 
 	IR_NODE_END()
@@ -1034,7 +1034,7 @@ namespace core {
 		 * @return the requested bind expression managed by the given manager
 		 */
 		static BindExprPtr get(NodeManager & manager, const FunctionTypePtr& type, const ParametersPtr& parameters, const CallExprPtr& call) {
-			return manager.get(BindExpr(type, parameters, call));
+			return manager.getNode<BindExpr>(type, parameters, call);
 		}
 
 		/**
@@ -1091,7 +1091,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static TupleExprPtr get(NodeManager & manager, const TupleTypePtr& type, const ExpressionsPtr& expressions) {
-			return manager.get(TupleExpr(type, expressions));
+			return manager.getNode<TupleExpr>(type, expressions);
 		}
 
 	IR_NODE_END()
@@ -1151,7 +1151,7 @@ namespace core {
 		 * @return the requested init expression
 		 */
 		static InitExprPtr get(NodeManager& manager, const GenericTypePtr& type, const ExpressionPtr& memoryExpr, const DeclarationsPtr& initDecls) {
-			return manager.get(InitExpr(type, memoryExpr, initDecls));
+			return manager.getNode<InitExpr>(type, memoryExpr, initDecls);
 		}
 
 	IR_NODE_END()
@@ -1198,7 +1198,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static JobExprPtr get(NodeManager & manager, const GenericTypePtr& type, const ExpressionPtr& range, const ExpressionPtr& def) {
-			return manager.get(JobExpr(type, range, def));
+			return manager.getNode<JobExpr>(type, range, def);
 		}
 
 	IR_NODE_END()
@@ -1252,7 +1252,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static MarkerExprPtr get(NodeManager & manager, const UIntValuePtr& id, const ExpressionPtr& subExpr) {
-			return manager.get(MarkerExpr(subExpr->getType(), id, subExpr));
+			return manager.getNode<MarkerExpr>(subExpr->getType(), id, subExpr);
 		}
 
 		/**
@@ -37,7 +37,9 @@
 
 #pragma once
 
+#include <limits>
 #include <map>
+#include <mutex>
 #include <typeindex>
 
 #include <boost/mpl/or.hpp>
@@ -60,6 +62,35 @@ namespace core {
 	struct MoveAnnotationOnClone;
 	struct AbortOnNodeCreation;
 
+	namespace detail {
+
+		/**
+		 * A visitor realizing the hashing for the value type potentially stored
+		 * within a node.
+		 */
+		struct HashVisitor : public boost::static_visitor<std::size_t> {
+			template <typename T>
+			std::size_t operator()(const T& value) const {
+				return boost::hash<T>()(value);
+			}
+
+			// hashing of integer values by according to http://www.concentric.net/~ttwang/tech/inthash.htm
+
+			std::size_t operator()(const char value) const {
+				return static_cast<std::size_t>(value * 2654435761);
+			}
+
+			std::size_t operator()(const int value) const {
+				return static_cast<std::size_t>(value * 2654435761);
+			}
+
+			std::size_t operator()(const unsigned value) const {
+				return static_cast<std::size_t>(value * 2654435761);
+			}
+		};
+
+	}
+
 	// **********************************************************************************
 	// 							    Abstract Node Base
 	// **********************************************************************************
@@ -85,6 +116,16 @@ namespace core {
 		 */
 		friend class InstanceManager<Node, Pointer, AbortOnNodeCreation, MoveAnnotationOnClone>;
 
+		/**
+		 * Nodes placed within the arena of a node manager are destructed by this functor.
+		 */
+		friend struct ::instance_disposal<Node>;
+
+		/**
+		 * The node manager is looking up nodes based on their hash values.
+		 */
+		friend class NodeManager;
+
 		/**
 		 * Allow the AbortOnNodeCreation to access the node's getNodeManagerPtr method.
 		 */
@@ -150,16 +191,36 @@ namespace core {
 		typedef uint64_t EqualityID;
 
 		/**
-		 * A static generator for generating equality class IDs
+		 * A static generator for generating equality class IDs (shared by all threads)
 		 */
-		static utils::SimpleIDGenerator<EqualityID> equalityClassIDGenerator;
+		static utils::ConcurrentIDGenerator<EqualityID> equalityClassIDGenerator;
 
 		/**
 		 * The ID of the equality class of this node. This ID is used to significantly
-		 * speed up the equality check.
+		 * speed up the equality check. Concurrent updates are benign since only IDs
+		 * of the same equality class are ever written.
 		 */
 		mutable EqualityID equalityID;
 
+		/**
+		 * The number of nodes of the tree rooted by this node if all shared sub-structures
+		 * would be unfolded (saturated at the maximum value of the type).
+		 */
+		uint64_t treeSize;
+
+		/**
+		 * The height of the tree rooted by this node (value nodes have a height of 1).
+		 */
+		unsigned treeDepth;
+
+		/**
+		 * The number of distinct nodes reachable from this node (including itself). Since
+		 * it can not be derived from the child properties it is computed lazily on first
+		 * demand, where 0 marks an unknown value. Concurrent updates are benign since all
+		 * threads would write the same value.
+		 */
+		mutable uint64_t dagSize;
+
 		/**
 		 * The annotatable part of the node.
 		 */
@@ -177,7 +238,7 @@ namespace core {
 		template <typename... Nodes>
 		Node(const NodeType nodeType, const NodeCategory nodeCategory, const Pointer<const Nodes>&... children)
 		    : HashableImmutableData(hashNodes(nodeType, children...)), nodeType(nodeType), children(toVector<NodePtr>(children...)), nodeCategory(nodeCategory),
-		      manager(0), equalityID(0) {
+		      manager(0), equalityID(0), treeSize(sumTreeSizes(this->children)), treeDepth(maxTreeDepth(this->children) + 1), dagSize(0) {
 			// ensure that there no non-value node is of the value type
 			assert_ne(nodeCategory, NC_Value) << "Must not be a value node!";
 		}
@@ -200,7 +261,7 @@ namespace core {
 		 */
 		Node(const NodeType nodeType, const NodeCategory nodeCategory, const NodeList& children)
 		    : HashableImmutableData(hashNodes(nodeType, children)), nodeType(nodeType), children(children), nodeCategory(nodeCategory), manager(0),
-		      equalityID(0) {}
+		      equalityID(0), treeSize(sumTreeSizes(children)), treeDepth(maxTreeDepth(children) + 1), dagSize(0) {}
 
 		/**
 		 * Make node destructor virtual since sub-types may contain extra data fields.
@@ -225,6 +286,21 @@ namespace core {
 			return ::operator delete(ptr);
 		}
 
+		/**
+		 * Allocates a node within the given arena. Nodes maintained by a node manager are placed
+		 * within the arena of the manager, reducing the number of allocations and improving the
+		 * locality of nodes created together.
+		 */
+		static void* operator new(size_t size, utils::Arena& arena) {
+			return arena.allocate(size);
+		}
+
+		/**
+		 * The counterpart of the arena-based new operator, only invoked if a constructor fails.
+		 * The memory is released together with the arena.
+		 */
+		void operator delete(void* ptr, utils::Arena& arena) {}
+
 		/**
 		 * Defines the new operator for arrays to be protected. This prevents instances of AST nodes to be
 		 * created on the heap or stack without a NodeManager, thereby enforcing the usage of the
@@ -287,6 +363,17 @@ namespace core {
 			return children;
 		}
 
+		/**
+		 * Obtains the number of distinct nodes reachable from this node, including
+		 * the node itself. The value is computed on the first call and cached.
+		 *
+		 * @return the number of distinct nodes within the DAG rooted by this node
+		 */
+		uint64_t getDAGSizeInternal() const {
+			if(dagSize == 0) { dagSize = computeDAGSize(); }
+			return dagSize;
+		}
+
 		/**
 		 * Obtains a reference to the manager maintaining this node instance. In case this
 		 * node is not managed by any node manager (by any reason), an assertion will be violated.
@@ -476,6 +563,16 @@ namespace core {
 		 */
 		virtual Node* createInstanceUsing(const NodeList& children) const = 0;
 
+		/**
+		 * The same as the function above, yet the new instance is placed within the given arena.
+		 * The resulting instance must not be deleted - it has to be destructed explicitly.
+		 *
+		 * @param children the children to be used for the construction
+		 * @param arena the arena to be allocating the new instance from
+		 * @return a pointer to a new, fresh instance of the requested node
+		 */
+		virtual Node* createInstanceUsing(const NodeList& children, utils::Arena& arena) const = 0;
+
 	  private:
 		/**
 		 * Retrieves a clone of this node, hence a newly allocated instance representing the same value
@@ -517,9 +614,87 @@ namespace core {
 			for_each(nodes, [&](const NodePtr& cur) { utils::appendHash(seed, *cur); });
 			return seed;
 		}
+
+		/**
+		 * A static utility function computing the tree size of a node based on the
+		 * given list of children. The result is saturated instead of overflowing.
+		 *
+		 * @param nodes the child nodes of the node to be constructed
+		 * @return the number of nodes of the tree rooted by the resulting node
+		 */
+		static uint64_t sumTreeSizes(const NodeList& nodes) {
+			uint64_t res = 1;
+			for(const auto& cur : nodes) {
+				res += std::min((*cur).treeSize, std::numeric_limits<uint64_t>::max() - res);
+			}
+			return res;
+		}
+
+		/**
+		 * A static utility function determining the maximum tree depth of the given nodes.
+		 *
+		 * @param nodes the child nodes of the node to be constructed
+		 * @return the maximum depth of the given nodes, 0 if the list is empty
+		 */
+		static unsigned maxTreeDepth(const NodeList& nodes) {
+			unsigned res = 0;
+			for(const auto& cur : nodes) {
+				res = std::max(res, (*cur).treeDepth);
+			}
+			return res;
+		}
+
+		/**
+		 * Counts the distinct nodes reachable from this node by a traversal of the DAG.
+		 */
+		uint64_t computeDAGSize() const;
+
+		/**
+		 * A static utility function used for hashing a node type and the value
+		 * represented by a value node during its construction.
+		 *
+		 * @param type the type of the node to be hashed
+		 * @param value the value represented by the node
+		 * @return a hash value for the resulting node
+		 */
+		template <typename V>
+		static std::size_t hashValue(NodeType type, const V& value) {
+			std::size_t seed = 0;
+			boost::hash_combine(seed, type);
+			boost::hash_combine(seed, detail::HashVisitor()(value));
+			return seed;
+		}
+
+		/**
+		 * Tests whether the given child list is equivalent to the given list of nodes.
+		 */
+		template <typename... Nodes>
+		static bool equalChildren(const NodeList& list, const Pointer<const Nodes>&... nodes) {
+			if(list.size() != sizeof...(Nodes)) { return false; }
+			std::size_t i = 0;
+			bool res = true;
+			(void)std::initializer_list<int>{(res = res && *list[i++] == *nodes, 0)...};
+			return res;
+		}
 	};
 
 
+} // end namespace core
+} // end namespace insieme
+
+/**
+ * Nodes are placed within the arena of their node manager, and thus only have to be destructed.
+ */
+template <>
+struct instance_disposal<insieme::core::Node> {
+	void operator()(const insieme::core::Node* node) const {
+		node->~Node();
+	}
+};
+
+namespace insieme {
+namespace core {
+
 	// **********************************************************************************
 	// 									Node Manager
 	// **********************************************************************************
@@ -532,6 +707,9 @@ namespace core {
 	namespace inspyer {
 		class MetaGenerator;
 	}
+	namespace types {
+		struct TypeMemo;
+	}
 
 	/**
 	 * A functor realizing the migration of annotations after nodes have been moved
@@ -588,15 +766,21 @@ namespace core {
 			 */
 			ExtensionMap extensions;
 
+			/**
+			 * The lock protecting the extension store. It is recursive since loading an
+			 * extension may trigger the loading of further extensions.
+			 */
+			std::recursive_mutex extensionsLock;
+
 			/**
 			 * The store maintaining node manager annotations.
 			 */
 			const utils::Annotatable<NodeAnnotation> annotations;
 
 			/**
-			 * A static generator for generating IDs
+			 * A generator for generating fresh IDs, shared by all threads using this manager
 			 */
-			utils::SimpleIDGenerator<unsigned> idGenerator;
+			utils::ConcurrentIDGenerator<unsigned> idGenerator;
 
 			/**
 			 * An instance of the INSPYER MetaGenerator
@@ -626,6 +810,13 @@ namespace core {
 		 */
 		std::shared_ptr<NodeManagerData> data;
 
+		/**
+		 * The memo tables of type operations applied to types of this manager. Unlike the data
+		 * above, it is not shared within the hierarchy since memorized results may refer to
+		 * nodes of this manager.
+		 */
+		std::shared_ptr<types::TypeMemo> typeMemo;
+
 	  public:
 		/**
 		 * A default constructor creating a fresh, empty node manager instance.
@@ -664,7 +855,8 @@ namespace core {
 		/**
 		 * Obtains access to a generic language extension to be offered by this
 		 * node manager. If the extension has not been loaded yet, it will be during
-		 * the execution of this method.
+		 * the execution of this method. Concurrent requests for the same extension
+		 * are guaranteed to obtain the same instance.
 		 *
 		 * @tparam E the extension to be obtained
 		 * @return a reference to the requested language extension
@@ -673,6 +865,7 @@ namespace core {
 		const E& getLangExtension() {
 			// look up type information within map
 			std::type_index key = typeid(E);
+			std::lock_guard<std::recursive_mutex> guard(data->extensionsLock);
 			auto& ext = data->extensions;
 			auto pos = ext.find(key);
 			if(pos != ext.end()) { return static_cast<const E&>(*(pos->second)); }
@@ -695,6 +888,76 @@ namespace core {
 			return getLangExtension<E>();
 		}
 
+		/**
+		 * Obtains the node of type N composed of the given child nodes maintained by this manager. If
+		 * such a node is already present, it is located without creating a temporary node instance,
+		 * otherwise a new node is created and added to this manager.
+		 *
+		 * @tparam N the type of node to be obtained
+		 * @param children the child nodes of the requested node
+		 * @return a pointer to the requested node maintained by this manager
+		 */
+		template <typename N, typename... Children>
+		Pointer<const N> getNode(const Pointer<const Children>&... children) {
+			static const NodeType type = concrete_node_type<N>::nt_value;
+			std::size_t hash = Node::hashNodes(type, children...);
+			auto res = lookupPlain(hash, [&](const Node& cur) {
+				return cur.hash() == hash && cur.nodeType == type && Node::equalChildren(cur.getChildNodeList(), children...);
+			});
+			if(res) { return found<N>(res); }
+			return get(N(children...));
+		}
+
+		/**
+		 * Obtains the node of type N exhibiting the given list of child nodes maintained by this manager.
+		 * Like the variant above, no temporary node is created if the node is already present.
+		 *
+		 * @tparam N the type of node to be obtained
+		 * @param children the child nodes of the requested node
+		 * @return a pointer to the requested node maintained by this manager
+		 */
+		template <typename N>
+		Pointer<const N> getNode(const NodeList& children) {
+			static const NodeType type = concrete_node_type<N>::nt_value;
+			std::size_t hash = Node::hashNodes(type, children);
+			auto res = lookupPlain(hash, [&](const Node& cur) {
+				return cur.hash() == hash && cur.nodeType == type && ::equals(cur.getChildNodeList(), children, equal_target<NodePtr>());
+			});
+			if(res) { return found<N>(res); }
+			return get(N(children));
+		}
+
+		/**
+		 * Obtains the value node of type N representing the given value maintained by this manager.
+		 * Like the variants above, no temporary node is created if the node is already present.
+		 *
+		 * @tparam N the type of value node to be obtained
+		 * @param value the value to be represented
+		 * @return a pointer to the requested node maintained by this manager
+		 */
+		template <typename N, typename V>
+		Pointer<const N> getValueNode(const V& value) {
+			static const NodeType type = concrete_node_type<N>::nt_value;
+			std::size_t hash = Node::hashValue(type, value);
+			auto res = lookupPlain(hash, [&](const Node& cur) {
+				return cur.hash() == hash && cur.nodeType == type && boost::get<V>(cur.getNodeValue()) == value;
+			});
+			if(res) { return found<N>(res); }
+			return get(N(value));
+		}
+
+	  private:
+		/**
+		 * Completes a successful lookup of one of the getNode functions.
+		 */
+		template <typename N>
+		Pointer<const N> found(const Node* node) const {
+			static const AbortOnNodeCreation lookupAction = AbortOnNodeCreation();
+			lookupAction(node, node);
+			return Pointer<const N>(static_cast<const N*>(node));
+		}
+
+	  public:
 		/**
 		 * Obtains a fresh ID to be used within a node.
 		 */
@@ -721,6 +984,13 @@ namespace core {
 			return data->abortNode;
 		}
 
+		/**
+		 * Obtains the memo tables of type operations applied to types maintained by this manager.
+		 */
+		types::TypeMemo& getTypeMemo() const {
+			return *typeMemo;
+		}
+
 		/**
 		 * Obtains a reference to the associated annotation container
 		 * of the root node manager.
@@ -1123,16 +1393,22 @@ namespace core {
 			NAME(const Pointer<const Children>&... children)                                                                                                   \
 			    : BASE(NT_##NAME, children...), Accessor<NAME, NAME, Pointer>::node_helper(getChildNodeList()) {}                                              \
                                                                                                                                                                \
+			/* The node manager may create instances without a temporary copy. */                                                                              \
+			friend class NodeManager;                                                                                                                          \
+                                                                                                                                                               \
 		  protected:                                                                                                                                           \
 			/* The function required for the clone process. */                                                                                                 \
 			virtual NAME* createInstanceUsing(const NodeList& children) const {                                                                                \
 				return new NAME(children);                                                                                                                     \
+			}                                                                                                                                                  \
+			virtual NAME* createInstanceUsing(const NodeList& children, utils::Arena& arena) const {                                                           \
+				return new (arena) NAME(children);                                                                                                             \
 			}                                                                                                                                                  \
                                                                                                                                                                \
 		  public:                                                                                                                                              \
 			/* A factory method creating instances based on a child list */                                                                                    \
 			static NAME##Ptr get(NodeManager& manager, const NodeList& children) {                                                                             \
-				return manager.get(NAME(children));                                                                                                            \
+				return manager.getNode<NAME>(children);                                                                                                        \
 			}                                                                                                                                                  \
                                                                                                                                                                \
 		  private:
@@ -1353,7 +1629,7 @@ namespace core {
 		 * @return the requested instance managed by the given manager
 		 */
 		static ExpressionsPtr get(NodeManager & manager, const ExpressionList& expressions) {
-			return manager.get(Expressions(convertList(expressions)));
+			return manager.getNode<Expressions>(convertList(expressions));
 		}
 	IR_NODE_END()
 
@@ -155,6 +155,36 @@ namespace core {
 			return getNode().children[index];
 		}
 
+		/**
+		 * Obtains the number of nodes of the tree rooted by this node, hence the number
+		 * of addressable nodes. The value is computed when constructing the node.
+		 *
+		 * @return the size of the unfolded tree, saturated at the maximum uint64_t value
+		 */
+		uint64_t getTreeSize() const {
+			return getNode().treeSize;
+		}
+
+		/**
+		 * Obtains the height of the tree rooted by this node, where a node without children
+		 * has a height of 1. The value is computed when constructing the node.
+		 *
+		 * @return the height of the tree rooted by this node
+		 */
+		unsigned getTreeDepth() const {
+			return getNode().treeDepth;
+		}
+
+		/**
+		 * Obtains the number of distinct nodes reachable from this node, including the node
+		 * itself. The value is computed on first demand and cached within the node.
+		 *
+		 * @return the number of nodes within the DAG rooted by this node
+		 */
+		uint64_t getDAGSize() const {
+			return getNode().getDAGSizeInternal();
+		}
+
 		/**
 		 * Obtains a reference to the manager maintaining this node instance. In case this
 		 * node is not managed by any node manager (by any reason), an assertion will be violated.
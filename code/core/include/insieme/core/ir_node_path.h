@@ -37,6 +37,12 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
 #include <boost/operators.hpp>
 
 #include "insieme/core/forward_decls.h"
@@ -70,6 +76,11 @@ namespace core {
 	/**
 	 * A base class for node path elements providing the essential operations including
 	 * the reference counting for elements.
+	 *
+	 * Elements are interned within their parent element, forming a trie of paths starting at
+	 * a common root element. Thus, extending the same path by the same step multiple times results
+	 * in the same element as long as it is alive, such that equal paths share their storage and can
+	 * be compared by identity. Parents only keep weak references to their children.
 	 */
 	template <typename Derived>
 	struct NodePathElementBase : public utils::Printable, public boost::equality_comparable<Derived>, public boost::less_than_comparable<Derived> {
@@ -107,7 +118,14 @@ namespace core {
 		 * the ref counter is set to 1. When decreasing it to 0, the instance will automatically
 		 * be freed.
 		 */
-		mutable std::size_t refCount;
+		mutable std::atomic<std::size_t> refCount;
+
+		/**
+		 * The interned child elements of this element, indexed by the child index. Entries are
+		 * weak references, cleared by the children when being destroyed. The list is only allocated
+		 * when extending this element and guarded by the lock obtained through getLock().
+		 */
+		mutable std::vector<const Derived*> children;
 
 	  public:
 		/**
@@ -133,6 +151,57 @@ namespace core {
 			if(parent) { parent->decRefCount(); }
 		}
 
+	  private:
+		/**
+		 * Obtains the lock guarding the interned children of the given element. Locks are
+		 * shared among elements to avoid a mutex per element.
+		 */
+		static std::mutex& getLock(const NodePathElementBase* element) {
+			static std::array<std::mutex, 64> locks;
+			return locks[(reinterpret_cast<std::uintptr_t>(element) / sizeof(Derived)) % locks.size()];
+		}
+
+		/**
+		 * Increments the reference counter unless the element is already being destroyed.
+		 *
+		 * @return true if the counter could be incremented, false otherwise
+		 */
+		bool tryIncRefCount() const {
+			std::size_t cur = refCount.load();
+			while(cur != 0) {
+				if(refCount.compare_exchange_weak(cur, cur + 1)) { return true; }
+			}
+			return false;
+		}
+
+	  public:
+		/**
+		 * Obtains the child element of this element addressing the given child, interning
+		 * new elements. The reference counter of the resulting element has been incremented
+		 * on behalf of the caller.
+		 *
+		 * @param index the index of the child to be addressed
+		 * @param value the value to be attached to the resulting element
+		 * @return the element addressing the requested child
+		 */
+		template <typename V>
+		const Derived* getChild(std::size_t index, const V& value) const {
+			const NodeList& list = ptr->getChildList();
+			assert_lt(index, list.size()) << "Child Index out of bound!";
+
+			std::lock_guard<std::mutex> guard(getLock(this));
+			if(children.empty()) { children.resize(list.size(), nullptr); }
+
+			// re-use an interned element if it is still alive
+			const Derived*& slot = children[index];
+			if(slot && slot->compareValue(value) == 0 && slot->tryIncRefCount()) { return slot; }
+
+			// create (and intern) a new element - a replaced one is no longer reachable via this element
+			slot = new Derived(list[index], index, value, static_cast<const Derived*>(this));
+			slot->incRefCount();
+			return slot;
+		}
+
 	  public:
 		/**
 		 * Obtains the path element referencing the root node of this path.
@@ -176,11 +245,18 @@ namespace core {
 		 * Decrement the reference counter for this path element.
 		 */
 		std::size_t decRefCount() const {
-			assert_gt(refCount, 0);
-			int res = --refCount;
-			if(refCount == 0) {
+			assert_gt(refCount.load(), 0);
+			std::size_t res = --refCount;
+			if(res == 0) {
+				// remove this element from the parent's interned elements
+				if(parent) {
+					std::lock_guard<std::mutex> guard(getLock(parent));
+					auto& list = parent->children;
+					if(index < list.size() && list[index] == this) { list[index] = nullptr; }
+				}
+
 				// commit suicide
-				delete this;
+				delete static_cast<const Derived*>(this);
 			}
 			return res;
 		}
@@ -415,6 +491,17 @@ namespace core {
 			if(element) { element->incRefCount(); }
 		}
 
+		/**
+		 * A marker type for constructing paths adopting a reference already counted for them.
+		 */
+		struct adopt {};
+
+		/**
+		 * A private constructor to create a path based on a path element whose reference
+		 * counter has already been incremented on behalf of the resulting path.
+		 */
+		NodePath(const NodePathElement<V>* element, adopt) : element(element) {}
+
 	  public:
 		/**
 		 * A default constructor for this class.
@@ -538,12 +625,7 @@ namespace core {
 		 */
 		NodePath extendForChild(unsigned index, const V& value = V()) const {
 			assert_true(element) << "Invalid Path cannot be extended.";
-
-			const NodePtr& cur = element->ptr;
-			const NodeList& list = cur->getChildList();
-			assert_lt(index, list.size()) << "Child Index out of bound!";
-
-			return NodePath(new NodePathElement<V>(list[index], index, value, element));
+			return NodePath(element->getChild(index, value), adopt());
 		}
 
 		/**
@@ -634,6 +716,14 @@ namespace core {
 			return (this == &other) || (element == other.element) || (element && other.element && *element == *other.element);
 		}
 
+		/**
+		 * Determines whether this path shares its representation with the given path. This is the
+		 * case for equal paths derived from the same root path while being alive concurrently.
+		 */
+		bool isIdentical(const NodePath& other) const {
+			return element == other.element;
+		}
+
 		/**
 		 * A comparison operator for two paths. Paths will be ordered lexicographical.
 		 */
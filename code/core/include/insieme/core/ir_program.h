@@ -82,6 +82,13 @@ namespace core {
 			return new Program(children);
 		}
 
+		/**
+		 * The function required for the clone process, placing the clone within the given arena.
+		 */
+		virtual Program* createInstanceUsing(const NodeList& children, utils::Arena& arena) const {
+			return new (arena) Program(children);
+		}
+
 	  public:
 		/**
 		 * A factory method creating instances based on a child list
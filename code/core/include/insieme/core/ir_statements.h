@@ -77,7 +77,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static BreakStmtPtr get(NodeManager & manager) {
-			return manager.get(BreakStmt());
+			return manager.getNode<BreakStmt>();
 		}
 	IR_NODE_END()
 
@@ -111,7 +111,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static ContinueStmtPtr get(NodeManager & manager) {
-			return manager.get(ContinueStmt());
+			return manager.getNode<ContinueStmt>();
 		}
 	IR_NODE_END()
 
@@ -149,7 +149,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static GotoStmtPtr get(NodeManager & manager, const StringValuePtr& label) {
-			return manager.get(GotoStmt(label));
+			return manager.getNode<GotoStmt>(label);
 		}
 	IR_NODE_END()
 
@@ -188,7 +188,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static LabelStmtPtr get(NodeManager & manager, const StringValuePtr& label) {
-			return manager.get(LabelStmt(label));
+			return manager.getNode<LabelStmt>(label);
 		}
 	IR_NODE_END()
 
@@ -232,7 +232,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static DeclarationPtr get(NodeManager & manager, const TypePtr& type, const ExpressionPtr& initExpression) {
-			return manager.get(Declaration(type, initExpression));
+			return manager.getNode<Declaration>(type, initExpression);
 		}
 	IR_NODE_END()
 
@@ -267,7 +267,7 @@ namespace core {
 		 * @return the requested instance managed by the given manager
 		 */
 		static DeclarationsPtr get(NodeManager & manager, const DeclarationList& declarations) {
-			return manager.get(Declarations(convertList(declarations)));
+			return manager.getNode<Declarations>(convertList(declarations));
 		}
 	IR_NODE_END()
 
@@ -367,7 +367,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static CompoundStmtPtr get(NodeManager & manager, const StatementList& stmts = StatementList()) {
-			return manager.get(CompoundStmt(convertList(stmts)));
+			return manager.getNode<CompoundStmt>(convertList(stmts));
 		}
 
 		/**
@@ -430,7 +430,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static IfStmtPtr get(NodeManager & manager, const ExpressionPtr& condition, const CompoundStmtPtr& thenStmt, const CompoundStmtPtr& elseStmt) {
-			return manager.get(IfStmt(condition, thenStmt, elseStmt));
+			return manager.getNode<IfStmt>(condition, thenStmt, elseStmt);
 		}
 
 	IR_NODE_END()
@@ -477,7 +477,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static WhileStmtPtr get(NodeManager & manager, const ExpressionPtr& condition, const CompoundStmtPtr& body) {
-			return manager.get(WhileStmt(condition, body));
+			return manager.getNode<WhileStmt>(condition, body);
 		}
 
 	IR_NODE_END()
@@ -560,7 +560,7 @@ namespace core {
 		 */
 		static ForStmtPtr get(NodeManager & manager, const DeclarationStmtPtr& varDecl, const ExpressionPtr& end, const ExpressionPtr& step,
 							  const CompoundStmtPtr& body) {
-			return manager.get(ForStmt(varDecl, end, step, body));
+			return manager.getNode<ForStmt>(varDecl, end, step, body);
 		}
 
 		/**
@@ -619,7 +619,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static SwitchCasePtr get(NodeManager & manager, const LiteralPtr& guard, const CompoundStmtPtr& body) {
-			return manager.get(SwitchCase(guard, body));
+			return manager.getNode<SwitchCase>(guard, body);
 		}
 
 	IR_NODE_END()
@@ -651,7 +651,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static SwitchCasesPtr get(NodeManager & manager, const vector<SwitchCasePtr>& cases) {
-			return manager.get(SwitchCases(convertList(cases)));
+			return manager.getNode<SwitchCases>(convertList(cases));
 		}
 
 	IR_NODE_END()
@@ -700,7 +700,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static SwitchStmtPtr get(NodeManager & manager, const ExpressionPtr& expr, const SwitchCasesPtr& cases, const CompoundStmtPtr& def) {
-			return manager.get(SwitchStmt(expr, cases, def));
+			return manager.getNode<SwitchStmt>(expr, cases, def);
 		}
 
 	IR_NODE_END()
@@ -754,7 +754,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static MarkerStmtPtr get(NodeManager & manager, const UIntValuePtr& id, const StatementPtr& subStmt) {
-			return manager.get(MarkerStmt(id, subStmt));
+			return manager.getNode<MarkerStmt>(id, subStmt);
 		}
 
 		/**
@@ -807,7 +807,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static ThrowStmtPtr get(NodeManager & manager, const ExpressionPtr& expression) {
-			return manager.get(ThrowStmt(expression));
+			return manager.getNode<ThrowStmt>(expression);
 		}
 
 	IR_NODE_END()
@@ -850,7 +850,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static CatchClausePtr get(NodeManager & manager, const VariablePtr& var, const CompoundStmtPtr& body) {
-			return manager.get(CatchClause(var, body));
+			return manager.getNode<CatchClause>(var, body);
 		}
 
 	IR_NODE_END()
@@ -890,7 +890,7 @@ namespace core {
 			NodeList children;
 			children.push_back(body);
 			children.insert(children.end(), catchClauses.begin(), catchClauses.end());
-			return manager.get(TryCatchStmt(children));
+			return manager.getNode<TryCatchStmt>(children);
 		}
 
 	IR_NODE_END()
@@ -213,6 +213,100 @@ namespace core {
 	};
 
 
+	class LivenessStatistic {
+	  public:
+		/**
+		 * A type definition for the information stored per node type.
+		 */
+		typedef struct {
+			unsigned numLive;
+			unsigned numDead;
+		} NodeTypeInfo;
+
+	  private:
+		/**
+		 * The number of nodes reachable from the given roots.
+		 */
+		unsigned numLiveNodes;
+
+		/**
+		 * The number of nodes no longer reachable from any of the given roots.
+		 */
+		unsigned numDeadNodes;
+
+		/**
+		 * The amount of memory consumed by live nodes (not including any annotations).
+		 */
+		unsigned liveMemory;
+
+		/**
+		 * The amount of memory consumed by dead nodes (not including any annotations).
+		 */
+		unsigned deadMemory;
+
+		/**
+		 * The statistical information stored per node type.
+		 */
+		NodeTypeInfo nodeTypeInfo[NUM_CONCRETE_NODE_TYPES];
+
+		/**
+		 * Creates a new instance of this class, initializing all values to 0.
+		 */
+		LivenessStatistic();
+
+	  public:
+		/**
+		 * Creates a summary of the live and dead nodes maintained by the given manager. A node
+		 * is considered live if it is reachable from one of the given roots. Nodes maintained
+		 * by base managers are not covered.
+		 *
+		 * @param manager the manager for which's content a statistic should be created
+		 * @param roots the nodes still referenced by the client of the manager
+		 * @return the collected statistic information
+		 */
+		static LivenessStatistic evaluate(const NodeManager& manager, const vector<NodePtr>& roots);
+
+		/**
+		 * Obtains the number of nodes reachable from the roots.
+		 */
+		unsigned getNumLiveNodes() const {
+			return numLiveNodes;
+		}
+
+		/**
+		 * Obtains the number of nodes not reachable from any of the roots.
+		 */
+		unsigned getNumDeadNodes() const {
+			return numDeadNodes;
+		}
+
+		/**
+		 * Obtains the amount of memory consumed by live nodes, not including annotations.
+		 */
+		unsigned getLiveMemory() const {
+			return liveMemory;
+		}
+
+		/**
+		 * Obtains the amount of memory consumed by dead nodes, not including annotations.
+		 * This is the amount of memory to be saved by compacting the manager.
+		 */
+		unsigned getDeadMemory() const {
+			return deadMemory;
+		}
+
+		/**
+		 * Returns the statistical data describing the distribution of live and
+		 * dead nodes of the given type.
+		 *
+		 * @return the statistical data collected regarding the node types.
+		 */
+		const NodeTypeInfo& getNodeTypeInfo(NodeType nodeType) const {
+			return nodeTypeInfo[nodeType];
+		}
+	};
+
+
 } // end namespace core
 } // end namespace insieme
 
@@ -228,4 +322,9 @@ namespace std {
 	 * Allows a node statistics to be directly printed into output streams.
 	 */
 	std::ostream& operator<<(std::ostream& out, const insieme::core::NodeStatistic& statistics);
+
+	/**
+	 * Allows a liveness statistics to be directly printed into output streams.
+	 */
+	std::ostream& operator<<(std::ostream& out, const insieme::core::LivenessStatistic& statistics);
 }
@@ -117,7 +117,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static TypesPtr get(NodeManager& manager, const TypeList& types) {
-			return manager.get(Types(convertList(types)));
+			return manager.getNode<Types>(convertList(types));
 		}
 	IR_NODE_END()
 
@@ -218,7 +218,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static ParentPtr get(NodeManager& manager, const BoolValuePtr& virtul, const UIntValuePtr& access, const TypePtr& type) {
-			return manager.get(Parent(virtul, access, type));
+			return manager.getNode<Parent>(virtul, access, type);
 		}
 
 		/**
@@ -246,7 +246,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static ParentPtr get(NodeManager& manager, const BoolValuePtr& virtul, AccessSpecifier access, const TypePtr& type) {
-			return manager.get(Parent(virtul, UIntValue::get(manager, (unsigned)access), type));
+			return manager.getNode<Parent>(virtul, UIntValue::get(manager, (unsigned)access), type);
 		}
 
 		/**
@@ -332,7 +332,7 @@ namespace core {
 		 * @return the requested parents list instance managed by the given manager
 		 */
 		static ParentsPtr get(NodeManager& manager, const ParentList& parents = ParentList()) {
-			return manager.get(Parents(convertList(parents)));
+			return manager.getNode<Parents>(convertList(parents));
 		}
 
 		/**
@@ -417,7 +417,7 @@ namespace core {
 		 * @param typeParams	the type parameters of this type, concrete or variable
 		 */
 		static GenericTypePtr get(NodeManager& manager, const StringValuePtr& name, const ParentsPtr& parents, const TypesPtr& typeParams) {
-			return manager.get(GenericType(name, parents, typeParams));
+			return manager.getNode<GenericType>(name, parents, typeParams);
 		}
 
 		/**
@@ -498,7 +498,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static TypeVariablePtr get(NodeManager& manager, const StringValuePtr& name) {
-			return manager.get(TypeVariable(name));
+			return manager.getNode<TypeVariable>(name);
 		}
 
 		/**
@@ -550,7 +550,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static VariadicTypeVariablePtr get(NodeManager& manager, const StringValuePtr& name) {
-			return manager.get(VariadicTypeVariable(name));
+			return manager.getNode<VariadicTypeVariable>(name);
 		}
 
 		/**
@@ -623,7 +623,7 @@ namespace core {
 		 * @param typeParams	the type parameters of this type, concrete or variable
 		 */
 		static GenericTypeVariablePtr get(NodeManager& manager, const StringValuePtr& name, const TypesPtr& typeParams) {
-			return manager.get(GenericTypeVariable(name, typeParams));
+			return manager.getNode<GenericTypeVariable>(name, typeParams);
 		}
 
 		/**
@@ -696,7 +696,7 @@ namespace core {
 		 * @param typeParams	the type parameters of this type, concrete or variable
 		 */
 		static VariadicGenericTypeVariablePtr get(NodeManager& manager, const StringValuePtr& name, const TypesPtr& typeParams) {
-			return manager.get(VariadicGenericTypeVariable(name, typeParams));
+			return manager.getNode<VariadicGenericTypeVariable>(name, typeParams);
 		}
 
 		/**
@@ -913,7 +913,7 @@ namespace core {
 	    static FunctionTypePtr get(NodeManager& manager, const TypesPtr& paramType, const TypePtr& returnType, FunctionKind kind = FK_PLAIN,
 	                               TypesPtr instantiationTypes = TypesPtr()) {
 		    if(!instantiationTypes) instantiationTypes = Types::get(manager, TypeList());
-		    return manager.get(FunctionType(paramType, returnType, UIntValue::get(manager, kind), instantiationTypes));
+		    return manager.getNode<FunctionType>(paramType, returnType, UIntValue::get(manager, kind), instantiationTypes);
 		}
 
 		/**
@@ -1013,7 +1013,7 @@ namespace core {
 		 * @return the requested type instance managed by the given manager
 		 */
 		static TagTypeReferencePtr get(NodeManager& manager, const StringValuePtr& name) {
-			return manager.get(TagTypeReference(name));
+			return manager.getNode<TagTypeReference>(name);
 		}
 
 		/**
@@ -1070,7 +1070,7 @@ namespace core {
 		 * @return the requested bindign managed by the given manager
 		 */
 		static TagTypeBindingPtr get(NodeManager& manager, const TagTypeReferencePtr& tag, const RecordPtr& record) {
-			return manager.get(TagTypeBinding(tag, record));
+			return manager.getNode<TagTypeBinding>(tag, record);
 		}
 	IR_NODE_END()
 
@@ -1414,7 +1414,7 @@ namespace core {
 		 * @param definition the tag type definition group providing the actual definition of of this tag type
 		 */
 		static TagTypePtr get(NodeManager& manager, const TagTypeReferencePtr& tag, const TagTypeDefinitionPtr& definition) {
-			return manager.get(TagType(tag, definition));
+			return manager.getNode<TagType>(tag, definition);
 		}
 
 		/**
@@ -1467,7 +1467,7 @@ namespace core {
 		 * @return the requested field instance managed by the given manager
 		 */
 		static FieldPtr get(NodeManager& manager, const StringValuePtr& name, const TypePtr& type) {
-			return manager.get(Field(name, type));
+			return manager.getNode<Field>(name, type);
 		}
 	IR_NODE_END()
 
@@ -1502,7 +1502,7 @@ namespace core {
 		 */
 		static FieldsPtr get(NodeManager& manager, const FieldList& fields = FieldList()) {
 			assert_false(hasDuplicates(fields, [](const FieldPtr& field) { return field->getName()->getValue(); }))  << "field names must be unique";
-			return manager.get(Fields(convertList(fields)));
+			return manager.getNode<Fields>(convertList(fields));
 		}
 
 	IR_NODE_END()
@@ -1580,7 +1580,7 @@ namespace core {
 		 * @return the requested member function instance managed by the given manager
 		 */
 		static MemberFunctionPtr get(NodeManager& manager, const BoolValuePtr& virtul, const StringValuePtr& name, const ExpressionPtr& impl) {
-			return manager.get(MemberFunction(name, virtul, impl));
+			return manager.getNode<MemberFunction>(name, virtul, impl);
 		}
 
 		/**
@@ -1631,7 +1631,7 @@ namespace core {
 	    static MemberFunctionsPtr get(NodeManager& manager, const MemberFunctionList& fields = MemberFunctionList()) {
 		    MemberFunctionList sorted = fields;
 		    std::stable_sort(sorted.begin(), sorted.end(), detail::semanticNodeLessThan);
-		    return manager.get(MemberFunctions(convertList(sorted)));
+		    return manager.getNode<MemberFunctions>(convertList(sorted));
 	    }
 
 	IR_NODE_END()
@@ -1689,7 +1689,7 @@ namespace core {
 		 * @return the requested pure virtual member function instance managed by the given manager
 		 */
 		static PureVirtualMemberFunctionPtr get(NodeManager& manager, const StringValuePtr& name, const FunctionTypePtr& type) {
-			return manager.get(PureVirtualMemberFunction(name, type));
+			return manager.getNode<PureVirtualMemberFunction>(name, type);
 		}
 
 		/**
@@ -1737,7 +1737,7 @@ namespace core {
 		 * @return the requested member function list instance managed by the given manager
 		 */
 		static PureVirtualMemberFunctionsPtr get(NodeManager& manager, const PureVirtualMemberFunctionList& fields = PureVirtualMemberFunctionList()) {
-			return manager.get(PureVirtualMemberFunctions(convertList(fields)));
+			return manager.getNode<PureVirtualMemberFunctions>(convertList(fields));
 		}
 
 	IR_NODE_END()
@@ -1795,7 +1795,7 @@ namespace core {
 		 * @return the requested static member function instance managed by the given manager
 		 */
 		static StaticMemberFunctionPtr get(NodeManager& manager, const StringValuePtr& name, const ExpressionPtr& implementation) {
-			return manager.get(StaticMemberFunction(name, implementation));
+			return manager.getNode<StaticMemberFunction>(name, implementation);
 		}
 
 		/**
@@ -1843,7 +1843,7 @@ namespace core {
 		 * @return the requested member function list instance managed by the given manager
 		 */
 		static StaticMemberFunctionsPtr get(NodeManager& manager, const StaticMemberFunctionList& methods = StaticMemberFunctionList()) {
-			return manager.get(StaticMemberFunctions(convertList(methods)));
+			return manager.getNode<StaticMemberFunctions>(convertList(methods));
 		}
 
 	IR_NODE_END()
@@ -2044,7 +2044,7 @@ namespace core {
 		                     const MemberFunctionsPtr& mfuns, const PureVirtualMemberFunctionsPtr& pvfuns, const StaticMemberFunctionsPtr& sfuns) {
 			ExpressionList sortedCtors = ctors.getExpressions();
 		    std::stable_sort(sortedCtors.begin(), sortedCtors.end(), detail::semanticNodeLessThan);
-			return manager.get(Struct(name, fields, Expressions::get(manager, sortedCtors), dtorOpt, dtorIsVirtual, mfuns, pvfuns, sfuns, parents));
+			return manager.getNode<Struct>(name, fields, Expressions::get(manager, sortedCtors), dtorOpt, dtorIsVirtual, mfuns, pvfuns, sfuns, parents);
 		}
 
 		/**
@@ -2210,7 +2210,7 @@ namespace core {
 		                    const MemberFunctionsPtr& mfuns, const PureVirtualMemberFunctionsPtr& pvfuns, const StaticMemberFunctionsPtr& sfuns) {
 			ExpressionList sortedCtors = ctors.getExpressions();
 		    std::stable_sort(sortedCtors.begin(), sortedCtors.end(), detail::semanticNodeLessThan);
-			return manager.get(Union(name, fields, Expressions::get(manager, sortedCtors), dtorOpt, dtorIsVirtual, mfuns, pvfuns, sfuns));
+			return manager.getNode<Union>(name, fields, Expressions::get(manager, sortedCtors), dtorOpt, dtorIsVirtual, mfuns, pvfuns, sfuns);
 		}
 
 		/**
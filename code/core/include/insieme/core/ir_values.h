@@ -87,9 +87,12 @@ namespace core {
 		class NAME##Value : public Value, public Accessor<NAME##Value, NAME##Value, Pointer> {                                                                 \
 			NAME##Value(const TYPE value) : Value(NT_##NAME##Value, value) {}                                                                                  \
                                                                                                                                                                \
+			/* The node manager may create instances without a temporary copy. */                                                                              \
+			friend class NodeManager;                                                                                                                          \
+                                                                                                                                                               \
 		  public:                                                                                                                                              \
 			static NAME##ValuePtr get(NodeManager& manager, const TYPE value) {                                                                                \
-				return manager.get(NAME##Value(value));                                                                                                        \
+				return manager.getValueNode<NAME##Value>(value);                                                                                               \
 			}                                                                                                                                                  \
 			static NAME##ValuePtr get(NodeManager& manager, const NodeList& children) {                                                                        \
 				assert_fail() << "Value nodes must not be constructed via their child node list!";                                                             \
@@ -110,6 +113,10 @@ namespace core {
 				assert_true(children.empty()) << "Value nodes must no have children!";                                                                         \
 				return new NAME##Value(*this);                                                                                                                 \
 			}                                                                                                                                                  \
+			virtual Node* createInstanceUsing(const NodeList& children, utils::Arena& arena) const {                                                           \
+				assert_true(children.empty()) << "Value nodes must no have children!";                                                                         \
+				return new (arena) NAME##Value(*this);                                                                                                         \
+			}                                                                                                                                                  \
 			virtual std::ostream& printTo(std::ostream& out) const {                                                                                           \
 				return out << getValue();                                                                                                                      \
 			}                                                                                                                                                  \
@@ -38,7 +38,11 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
 #include <queue>
 #include <functional>
@@ -1108,6 +1112,148 @@ namespace core {
 	}
 
 
+	namespace detail {
+
+		/**
+		 * The shared state of a parallel visit of all nodes reachable from some root node. Every
+		 * thread is processing nodes depth first using a local stack. Whenever other threads are
+		 * idle, children of the currently processed node are handed over to them.
+		 */
+		class ParallelVisitOnce {
+			/**
+			 * The number of shards of the set of visited nodes.
+			 */
+			static const unsigned NUM_SHARDS = 32;
+
+			/**
+			 * The visitor to be applied to all nodes.
+			 */
+			IRVisitor<void, Pointer>& visitor;
+
+			/**
+			 * The sets of already visited nodes, partitioned by the node hash.
+			 */
+			std::array<std::unordered_set<const Node*>, NUM_SHARDS> visited;
+			std::array<std::mutex, NUM_SHARDS> visitedLocks;
+
+			/**
+			 * The nodes handed over to idle threads.
+			 */
+			std::vector<NodePtr> shared;
+
+			/**
+			 * The number of threads waiting for nodes and the total number of threads.
+			 */
+			unsigned idle = 0;
+			unsigned numThreads;
+
+			/**
+			 * The lock and condition guarding the hand-over of nodes.
+			 */
+			std::mutex lock;
+			std::condition_variable available;
+
+		  public:
+			ParallelVisitOnce(IRVisitor<void, Pointer>& visitor, unsigned numThreads) : visitor(visitor), numThreads(numThreads) {}
+
+			void run(const NodePtr& root) {
+				shared.push_back(root);
+				std::vector<std::thread> threads;
+				for(unsigned i = 1; i < numThreads; i++) {
+					threads.emplace_back([&]() { work(); });
+				}
+				work();
+				for(auto& cur : threads) {
+					cur.join();
+				}
+			}
+
+		  private:
+			bool markVisited(const NodePtr& node) {
+				unsigned shard = (*node).hash() % NUM_SHARDS;
+				std::lock_guard<std::mutex> guard(visitedLocks[shard]);
+				return visited[shard].insert(node.ptr).second;
+			}
+
+			bool fetch(std::vector<NodePtr>& stack) {
+				std::unique_lock<std::mutex> guard(lock);
+				idle++;
+				while(shared.empty()) {
+					// if all threads are waiting, there is nothing left to do
+					if(idle == numThreads) {
+						available.notify_all();
+						return false;
+					}
+					available.wait(guard);
+				}
+				idle--;
+				stack.push_back(shared.back());
+				shared.pop_back();
+				return true;
+			}
+
+			void work() {
+				std::vector<NodePtr> stack;
+				while(!stack.empty() || fetch(stack)) {
+					NodePtr cur = stack.back();
+					stack.pop_back();
+
+					// skip nodes visited before and, if requested, types
+					if(!visitor.isVisitingTypes() && cur->getNodeCategory() == NC_Type) { continue; }
+					if(!markVisited(cur)) { continue; }
+
+					// visit current node
+					visitor.visit(cur);
+
+					// schedule child nodes - processed in pre-order, hand over the rest to idle threads
+					const auto& children = cur->getChildList();
+					std::size_t keep = children.size();
+					if(children.size() > 1) {
+						std::lock_guard<std::mutex> guard(lock);
+						if(idle > 0) {
+							keep = 1;
+							for(std::size_t i = children.size() - 1; i > 0; i--) {
+								shared.push_back(children[i]);
+							}
+							available.notify_all();
+						}
+					}
+					for(std::size_t i = keep; i > 0; i--) {
+						stack.push_back(children[i - 1]);
+					}
+				}
+			}
+		};
+
+	}
+
+	/**
+	 * The given visitor is applied to all nodes reachable starting from the given root node using
+	 * multiple threads. Like for visitDepthFirstOnce, shared nodes are visited only once. Each thread
+	 * is processing nodes depth first, handing over child nodes to idle threads. Thus, the order in
+	 * which nodes are visited is unspecified and the visitor has to support being invoked concurrently.
+	 *
+	 * @param root the root not to start the visiting from
+	 * @param visitor the visitor to be visiting all the nodes
+	 * @param numThreads the number of threads to be utilized, 0 for the number of available cores
+	 */
+	template <typename Node>
+	inline void visitDepthFirstOnceParallel(const Pointer<Node>& root, IRVisitor<void, Pointer>& visitor, unsigned numThreads = 0) {
+		if(numThreads == 0) { numThreads = std::max(std::thread::hardware_concurrency(), 1u); }
+		detail::ParallelVisitOnce(visitor, numThreads).run(root);
+	}
+
+	template <typename Node>
+	inline void visitDepthFirstOnceParallel(const Pointer<Node>& root, IRVisitor<void, Pointer>&& visitor, unsigned numThreads = 0) {
+		visitDepthFirstOnceParallel(root, visitor, numThreads);
+	}
+
+	template <typename Node, typename Lambda, typename Enable = typename boost::disable_if<boost::is_polymorphic<Lambda>, void>::type>
+	inline void visitDepthFirstOnceParallel(const Pointer<Node>& root, Lambda lambda, bool visitTypes = false, unsigned numThreads = 0) {
+		visitDepthFirstOnceParallel(root, makeLambdaVisitor(lambda, visitTypes), numThreads);
+	}
+
+
 	/**
 	 * The given visitor is DepthFirstly applied to all nodes reachable starting from the
 	 * given root node. If the given visitor returns true, the visiting will be interrupted.
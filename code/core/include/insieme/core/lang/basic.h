@@ -116,6 +116,7 @@ namespace core {
 			#include "insieme/core/lang/inspire_api/lang.def"
 
 			ExpressionPtr getBuiltIn(const std::string& name) const;
+			bool hasBuiltIn(const std::string& name) const;
 			LiteralPtr getLiteral(const string& name) const;
 
 			/**
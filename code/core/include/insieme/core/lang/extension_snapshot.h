@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#pragma once
+
+#include <iostream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <boost/noncopyable.hpp>
+
+#include "insieme/core/ir_node.h"
+#include "insieme/core/lang/extension.h"
+
+namespace insieme {
+namespace core {
+namespace lang {
+
+	/**
+	 * The name of the environment variable which may be set to the path of a snapshot file to be
+	 * loaded into the default snapshot. Such a file can be produced by the lang_snapshot driver.
+	 */
+	#define INSIEME_LANG_SNAPSHOT "INSIEME_LANG_SNAPSHOT"
+
+	/**
+	 * A snapshot of the IR constructs defined by language extensions. The constructs of language
+	 * extensions are defined by IR code snippets which need to be parsed whenever an extension is
+	 * instantiated within a new node manager. To avoid this overhead, the snapshot is caching the
+	 * parsed constructs within an internal node manager and copies them into the requesting managers
+	 * when being requested again.
+	 *
+	 * Constructs are identified by their source code and the symbols and type aliases visible when
+	 * parsing it. Snapshots may be stored to and loaded from streams using the binary IR dump format,
+	 * allowing the parsing to be skipped entirely within new processes.
+	 *
+	 * Snapshots are thread safe.
+	 */
+	class ExtensionSnapshot : private boost::noncopyable {
+
+		/**
+		 * The manager maintaining the nodes recorded by this snapshot.
+		 */
+		NodeManager manager;
+
+		/**
+		 * The recorded constructs, indexed by their key.
+		 */
+		std::map<string, NodePtr> entries;
+
+		/**
+		 * The lock protecting the internal state.
+		 */
+		mutable std::mutex lock;
+
+		/**
+		 * The number of requests served by recorded constructs.
+		 */
+		unsigned hits = 0;
+
+		/**
+		 * The number of requests which had to be parsed.
+		 */
+		unsigned misses = 0;
+
+	  public:
+		/**
+		 * Creates a new, empty snapshot.
+		 */
+		ExtensionSnapshot() : manager(1) {}
+
+		/**
+		 * Obtains the snapshot utilized by language extensions. On first access, the snapshot file
+		 * referenced by the INSIEME_LANG_SNAPSHOT environment variable is loaded, if present.
+		 */
+		static ExtensionSnapshot& getDefault();
+
+		/**
+		 * Obtains the given type within the given manager, parsing it only if not recorded yet.
+		 *
+		 * @param manager the manager to maintain the resulting type
+		 * @param spec the code of the type to be obtained
+		 * @param definitions the symbols visible when parsing the given code
+		 * @param aliases the type aliases active when parsing the given code
+		 * @return the requested type, maintained by the given manager, null if the code could not be parsed
+		 */
+		TypePtr getType(NodeManager& manager, const string& spec, const symbol_map& definitions = symbol_map(),
+		                const type_alias_map& aliases = type_alias_map());
+
+		/**
+		 * Obtains the given expression within the given manager, parsing it only if not recorded yet.
+		 *
+		 * @param manager the manager to maintain the resulting expression
+		 * @param spec the code of the expression to be obtained
+		 * @param definitions the symbols visible when parsing the given code
+		 * @param aliases the type aliases active when parsing the given code
+		 * @return the requested expression, maintained by the given manager, null if the code could not be parsed
+		 */
+		ExpressionPtr getExpression(NodeManager& manager, const string& spec, const symbol_map& definitions = symbol_map(),
+		                            const type_alias_map& aliases = type_alias_map());
+
+		/**
+		 * Obtains the number of recorded constructs.
+		 */
+		std::size_t size() const;
+
+		/**
+		 * Obtains the number of requests served by recorded constructs.
+		 */
+		unsigned getNumHits() const;
+
+		/**
+		 * Obtains the number of requests which had to be parsed.
+		 */
+		unsigned getNumMisses() const;
+
+		/**
+		 * Writes all recorded constructs into the given stream.
+		 */
+		void store(std::ostream& out) const;
+
+		/**
+		 * Adds the constructs stored within the given stream to this snapshot.
+		 *
+		 * @return true if the snapshot could be loaded, false otherwise
+		 */
+		bool load(std::istream& in);
+
+	  private:
+		/**
+		 * Obtains the construct of the given key within the given manager, using the given parser on a miss.
+		 */
+		NodePtr get(NodeManager& manager, const string& key, const std::function<NodePtr()>& parse);
+	};
+
+} // end namespace lang
+} // end namespace core
+} // end namespace insieme
@@ -41,6 +41,7 @@
 #include <sstream>
 #include <iostream>
 #include <map>
+#include <unordered_map>
 
 #include "insieme/core/forward_decls.h"
 #include "insieme/core/ir_builder.h"
@@ -112,11 +113,15 @@ namespace parser {
 		 */
 		class InspireDriver {
 
-			// scope management
+			// scope management - symbols are looked up for every identifier, hence hashed tables are used
+			typedef std::unordered_map<std::string, NodeFactory> SymbolTable;
+
 			struct Scope {
 				std::map<TypePtr, TypePtr> aliases;
-				DefinitionMap declaredSymbols;
-				DefinitionMap declaredTypes;
+				// the aliases indexed by the family name of their generic type pattern ("" for any other pattern)
+				std::unordered_map<std::string, std::map<TypePtr, TypePtr>> aliasIndex;
+				SymbolTable declaredSymbols;
+				SymbolTable declaredTypes;
 			};
 
 			mutable std::vector<ParserError> errors;
@@ -37,6 +37,7 @@
 
 #pragma once
 
+#include <set>
 #include <string>
 #include <memory>
 
@@ -74,6 +75,42 @@ typedef Match<tree_target> TreeMatch;
 typedef boost::optional<TreeMatch> TreeMatchOpt;
 
 
+/**
+ * An over-approximation of the set of nodes a tree pattern may match at its root. It is
+ * derived from the structure of the pattern and utilized for indexing patterns.
+ */
+struct RootFilter : public utils::Printable {
+	/**
+	 * A flag indicating that nodes of any type may be matched.
+	 */
+	bool anyType;
+
+	/**
+	 * The types of nodes which may be matched, if not any type may be matched.
+	 */
+	std::set<core::NodeType> types;
+
+	/**
+	 * A flag indicating whether types, values and type parameters may be matched.
+	 */
+	bool mayBeType;
+
+	/**
+	 * If not empty, the only nodes which may be matched (compared structurally).
+	 */
+	std::vector<core::NodePtr> atoms;
+
+	RootFilter() : anyType(true), mayBeType(true) {}
+
+	/**
+	 * Determines whether the given node passes this filter, hence whether it may be matched.
+	 */
+	bool covers(const core::NodePtr& node) const;
+
+	std::ostream& printTo(std::ostream& out) const;
+};
+
+
 /**
  * The type utilized to represent tree patterns matching tree structures.
  */
@@ -129,6 +166,11 @@ class TreePattern : public utils::Printable {
 
 	TreeMatchOpt matchTree(const TreePtr& tree) const;
 
+	/**
+	 * Obtains a filter covering all the IR nodes this pattern may match at its root.
+	 */
+	RootFilter getRootFilter() const;
+
 	/**
 	 * Enable default handling of assignments.
 	 */
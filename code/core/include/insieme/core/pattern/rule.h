@@ -59,6 +59,20 @@ namespace pattern {
 	  public:
 		Rule(const TreePattern& pattern = any, const TreeGenerator& generator = generator::root) : pattern(pattern), generator(generator) {}
 
+		/**
+		 * Obtains the pattern to be matched by this rule.
+		 */
+		const TreePattern& getPattern() const {
+			return pattern;
+		}
+
+		/**
+		 * Obtains the generator producing the replacement of matched structures.
+		 */
+		const TreeGenerator& getGenerator() const {
+			return generator;
+		}
+
 		/**
 		 * Applies this rule to the given input node.
 		 * If the rule does not fit a null pointer will be returned.
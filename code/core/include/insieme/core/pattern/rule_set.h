@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <unordered_set>
+#include <vector>
+
+#include "insieme/core/ir_node.h"
+#include "insieme/core/pattern/rule.h"
+
+#include "insieme/utils/printable.h"
+
+namespace insieme {
+namespace core {
+namespace pattern {
+
+	/**
+	 * A memo of the nodes a rule set is known not to be applicable to. Since rules are pure, such
+	 * nodes may be skipped when repeatedly searching a DAG for applicable nodes, e.g. while computing
+	 * a fixpoint. The memo refers to nodes without owning them and must thus not outlive them.
+	 */
+	struct MatchFailureMemo {
+		/**
+		 * The nodes no rule is applicable to.
+		 */
+		std::unordered_set<const core::Node*> failedNodes;
+
+		/**
+		 * The roots of sub-DAGs not containing any node a rule is applicable to.
+		 */
+		std::unordered_set<const core::Node*> failedSubDAGs;
+	};
+
+	/**
+	 * An ordered list of rules indexed by the types and atoms of the nodes their patterns may match at
+	 * their root. When being applied to a node, only the candidate rules for the node's type are
+	 * attempted. Apart from that, a rule set behaves like testing its rules in order.
+	 */
+	class RuleSet : public utils::Printable {
+		/**
+		 * The rules of this set, in the order they are attempted.
+		 */
+		std::vector<Rule> rules;
+
+		/**
+		 * The root filters of the patterns of the rules.
+		 */
+		std::vector<RootFilter> filters;
+
+		/**
+		 * For each node type the ordered list of indices of rules which may be applicable.
+		 */
+		std::vector<std::vector<unsigned>> candidates;
+
+		/**
+		 * Statistics on the number of attempted and skipped rule applications.
+		 */
+		mutable std::atomic<unsigned> attempts;
+		mutable std::atomic<unsigned> skipped;
+
+	  public:
+		/**
+		 * Creates a rule set indexing the given rules.
+		 */
+		RuleSet(const std::vector<Rule>& rules = std::vector<Rule>());
+
+		/**
+		 * Copies the rules and the index of the given set, not its statistics.
+		 */
+		RuleSet(const RuleSet& other);
+
+		RuleSet& operator=(const RuleSet& other);
+
+		/**
+		 * Obtains the indexed rules.
+		 */
+		const std::vector<Rule>& getRules() const {
+			return rules;
+		}
+
+		/**
+		 * Obtains the indices of the rules which may be applicable to nodes of the given type.
+		 */
+		const std::vector<unsigned>& getCandidates(core::NodeType type) const {
+			return candidates[type];
+		}
+
+		/**
+		 * Applies the first applicable rule to the given node.
+		 * If no rule is applicable, a null pointer will be returned.
+		 */
+		core::NodePtr applyTo(const core::NodePtr& node) const;
+
+		/**
+		 * Applies the first applicable rule to the first node in the given DAG it is applicable to (in pre-order),
+		 * replacing all occurrences of this node. If there is no such node, a null pointer will be returned.
+		 *
+		 * @param node the root of the DAG to be searched
+		 * @param memo the nodes known not to be applicable, which is updated by this call
+		 */
+		core::NodePtr applyToNested(const core::NodePtr& node, MatchFailureMemo& memo) const;
+
+		core::NodePtr applyToNested(const core::NodePtr& node) const {
+			MatchFailureMemo memo;
+			return applyToNested(node, memo);
+		}
+
+		/**
+		 * Applies the rules of this set until a fixpoint is reached.
+		 */
+		core::NodePtr fixpoint(const core::NodePtr& node) const;
+
+		/**
+		 * Applies the rules of this set to all nested sub-structures until a fixpoint is reached. Failed
+		 * matches are remembered across iterations, such that unmodified sub-DAGs are not searched again.
+		 */
+		core::NodePtr fixpointNested(const core::NodePtr& node) const;
+
+		/**
+		 * Obtains the number of rules attempted to be applied to nodes.
+		 */
+		unsigned getNumAttempts() const {
+			return attempts;
+		}
+
+		/**
+		 * Obtains the number of rule applications skipped by the index.
+		 */
+		unsigned getNumSkipped() const {
+			return skipped;
+		}
+
+		std::ostream& printTo(std::ostream& out) const;
+
+	  private:
+		core::NodePtr find(const core::NodePtr& node, MatchFailureMemo& memo, core::NodePtr& match) const;
+	};
+
+} // end namespace pattern
+} // end namespace core
+} // end namespace insieme
@@ -37,6 +37,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "insieme/core/ir_node.h"
 #include "insieme/core/ir_address.h"
 
@@ -101,6 +103,35 @@ namespace utils {
 		return res;
 	}
 
+	/**
+	 * A utility function compacting the IR reachable from the given roots by migrating it, including
+	 * potential migrateable annotations, to the given node manager. Intermediate IR versions accumulated
+	 * within the source manager which are no longer reachable from any of the roots are not copied.
+	 * Once no other references are left, the source manager may be destroyed to release those nodes.
+	 *
+	 * The fresh ID generator of the target manager is advanced beyond the one of the source manager,
+	 * such that variables created after the compaction do not collide with migrated ones.
+	 *
+	 * @param roots the roots of the IR fragments to be preserved, all maintained by the same manager
+	 * @param trgMgr the targeted node manager, typically a freshly created one
+	 * @return copies of the given roots maintained by the target manager, in the same order
+	 */
+	inline vector<NodePtr> compact(const vector<NodePtr>& roots, NodeManager& trgMgr) {
+		vector<NodePtr> res;
+		if(roots.empty()) { return res; }
+
+		// continue fresh IDs where the source manager stopped
+		unsigned next = std::max(roots.front()->getNodeManager().getFreshID(), trgMgr.getFreshID());
+		trgMgr.setNextFreshID(next + 1);
+
+		// migrate the reachable IR
+		for(const auto& cur : roots) {
+			assert_eq(&cur->getNodeManager(), &roots.front()->getNodeManager()) << "All roots have to be maintained by the same manager!";
+			res.push_back(migrate(cur, trgMgr));
+		}
+		return res;
+	}
+
 
 } // end namespace utils
 } // end namespace transform
@@ -99,6 +99,23 @@ namespace core {
 		 */
 		NodePtr replaceAll(NodeManager& mgr, const NodePtr& root, const NodeMap& replacements, const ReplaceLimiter limiter = localReplacement);
 
+		/**
+		 * A parallel version of the replaceAll operation above. Children of nodes rooting sub-DAGs of at least the
+		 * given number of nodes are processed concurrently, as long as threads are available. The result is the
+		 * same as for the sequential version. If the limiter requests an interrupt, the replacement is restarted
+		 * sequentially to obtain the same result. The limiter has to support being invoked concurrently.
+		 *
+		 * @param mgr the manager used to maintain new nodes, in case new nodes have to be formed
+		 * @param root the root of the sub-tree to be manipulated
+		 * @param replacements the map mapping nodes to their replacements
+		 * @param limiter customizes the scope of the replacement
+		 * @param numThreads the maximum number of threads to be utilized, 0 for the number of available cores
+		 * @param threshold the minimum number of nodes of a sub-DAG for processing its children concurrently
+		 * @return the modified version of the root node
+		 */
+		NodePtr replaceAllParallel(NodeManager& mgr, const NodePtr& root, const NodeMap& replacements, const ReplaceLimiter limiter = localReplacement,
+		                           unsigned numThreads = 0, unsigned threshold = 1000);
+
 		/**
 		 * A generic wrapper for the function provided above. This operation returns the same kind of node
 		 * pointer is getting passed as an argument.
@@ -308,7 +308,12 @@ namespace tu {
 		return merge(mgr, merge(mgr, a, b), rest...);
 	}
 
-	IRTranslationUnit merge(core::NodeManager& mgr, const vector<IRTranslationUnit>& units);
+	/**
+	 * Merges the given list of translation units into a single unit maintained by the given manager.
+	 * Units are merged pairwise in a tree-like fashion, where pairs on the same level are processed
+	 * by up to the given number of threads. The result does not depend on the number of threads.
+	 */
+	IRTranslationUnit merge(core::NodeManager& mgr, const vector<IRTranslationUnit>& units, unsigned numThreads = 1);
 
 
 	// -------------- program conversion ----------------------
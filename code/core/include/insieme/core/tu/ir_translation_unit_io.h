@@ -37,7 +37,10 @@
 
 #pragma once
 
+#include <memory>
+
 #include "insieme/core/tu/ir_translation_unit.h"
+#include "insieme/core/dump/binary_dump.h"
 
 namespace insieme {
 namespace core {
@@ -71,6 +74,107 @@ namespace tu {
 	 */
 	IRTranslationUnit load(std::istream& in, core::NodeManager& manager);
 
+	/**
+	 * Dumps the given translation unit to the given output stream using the indexed binary
+	 * format, such that the definitions of its symbols may be restored on demand.
+	 *
+	 * @param out the target stream
+	 * @param unit the translation unit to be dumped
+	 */
+	void dumpIndexed(std::ostream& out, const IRTranslationUnit& unit);
+
+	/**
+	 * A translation unit stored in the indexed binary format. The globals, initializers and entry
+	 * points as well as the symbols of all types and functions are restored when loading the unit,
+	 * while the definitions of those symbols are only restored when being requested.
+	 */
+	class LazyIRTranslationUnit {
+		/**
+		 * The loader restoring nodes on demand.
+		 */
+		std::shared_ptr<dump::binary::LazyIRLoader> loader;
+
+		/**
+		 * A translation unit covering all parts of the unit but the type and function definitions
+		 * and the entry points, which may only be added once their definitions are present.
+		 */
+		IRTranslationUnit base;
+
+		/**
+		 * The entry points of this unit.
+		 */
+		IRTranslationUnit::EntryPointList entryPoints;
+
+		/**
+		 * The index of the root holding the definition of each type and function symbol.
+		 */
+		insieme::utils::map::PointerMap<core::NodePtr, unsigned> definitions;
+
+	  public:
+		/**
+		 * Creates a lazy translation unit based on the given loader.
+		 *
+		 * @param manager the node manager used by the given loader
+		 * @param loader the loader operating on an encoding produced by dumpIndexed
+		 */
+		LazyIRTranslationUnit(core::NodeManager& manager, const std::shared_ptr<dump::binary::LazyIRLoader>& loader);
+
+		/**
+		 * Obtains the part of this unit restored eagerly, hence all but the type and function definitions
+		 * and the entry points.
+		 */
+		const IRTranslationUnit& getBase() const {
+			return base;
+		}
+
+		/**
+		 * Obtains the entry points of this unit.
+		 */
+		const IRTranslationUnit::EntryPointList& getEntryPoints() const {
+			return entryPoints;
+		}
+
+		/**
+		 * Determines whether this unit is providing a definition for the given type or function symbol.
+		 */
+		bool isDefined(const core::NodePtr& symbol) const {
+			return definitions.find(symbol) != definitions.end();
+		}
+
+		/**
+		 * Obtains the definition of the given type or function symbol, restoring it if necessary.
+		 *
+		 * @param symbol the symbol to be looked up
+		 * @return the definition of the given symbol or null if it is not defined by this unit
+		 */
+		core::NodePtr getDefinition(const core::NodePtr& symbol) const;
+
+		/**
+		 * Restores the full translation unit, including all definitions.
+		 */
+		IRTranslationUnit materialize() const;
+
+		/**
+		 * Obtains the number of nodes restored so far, for diagnostic purposes.
+		 */
+		std::size_t getNumMaterializedNodes() const {
+			return loader->getNumMaterializedNodes();
+		}
+	};
+
+	/**
+	 * Links the given lazily loaded translation units to the given unit. Only the definitions of
+	 * types and functions reachable from the resulting unit are restored. Definitions of the libraries
+	 * take precedence over those of the given unit, the first library defining a symbol takes precedence
+	 * over the following ones, consistent with the merge of eagerly loaded libraries.
+	 *
+	 * @param mgr the node manager to be utilized for the resulting unit
+	 * @param unit the unit to link the libraries to
+	 * @param libs the libraries to be linked
+	 * @return the linked translation unit
+	 */
+	IRTranslationUnit link(core::NodeManager& mgr, const IRTranslationUnit& unit, const vector<LazyIRTranslationUnit>& libs);
+
 } // end namespace tu
 } // end namespace core
 } // end namespace insieme
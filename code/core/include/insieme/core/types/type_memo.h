@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/functional/hash.hpp>
+
+#include "insieme/core/ir_types.h"
+#include "insieme/core/types/substitution.h"
+
+#include "insieme/utils/printable.h"
+
+namespace insieme {
+namespace core {
+namespace types {
+
+	// -------------------------------------------------------------------------------------------------------------------------
+	//                                                    Memo Tables
+	// -------------------------------------------------------------------------------------------------------------------------
+
+	namespace detail {
+
+		/**
+		 * A hash functor for the keys of memo tables, hashing nodes by their (interned) address.
+		 */
+		struct MemoKeyHash {
+			template <typename T>
+			std::size_t operator()(const Pointer<T>& node) const {
+				return std::hash<Pointer<T>>()(node);
+			}
+
+			template <typename T>
+			std::size_t operator()(const vector<T>& list) const {
+				std::size_t seed = list.size();
+				for(const auto& cur : list) {
+					boost::hash_combine(seed, (*this)(cur));
+				}
+				return seed;
+			}
+
+			template <typename A, typename B>
+			std::size_t operator()(const std::pair<A, B>& pair) const {
+				std::size_t seed = (*this)(pair.first);
+				boost::hash_combine(seed, (*this)(pair.second));
+				return seed;
+			}
+		};
+
+	}
+
+	/**
+	 * A memo table caching the results of a pure function on types. Lookups are thread safe, while
+	 * results are computed without holding the lock, such that the function may recursively use the
+	 * same table.
+	 *
+	 * @tparam Key the type of argument(s) of the memorized function, compared by node identity
+	 * @tparam Value the type of result of the memorized function
+	 */
+	template <typename Key, typename Value>
+	class MemoTable : public utils::Printable {
+		std::string name;
+		std::unordered_map<Key, Value, detail::MemoKeyHash> entries;
+		mutable std::mutex lock;
+		unsigned hits;
+		unsigned misses;
+
+	  public:
+		MemoTable(const std::string& name) : name(name), hits(0), misses(0) {}
+
+		/**
+		 * Obtains the value memorized for the given key or computes and memorizes it using the given operation.
+		 */
+		template <typename Compute>
+		Value get(const Key& key, const Compute& compute) {
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				auto pos = entries.find(key);
+				if(pos != entries.end()) {
+					hits++;
+					return pos->second;
+				}
+				misses++;
+			}
+			Value res = compute();
+			std::lock_guard<std::mutex> guard(lock);
+			return entries.emplace(key, res).first->second;
+		}
+
+		unsigned getNumHits() const {
+			std::lock_guard<std::mutex> guard(lock);
+			return hits;
+		}
+
+		unsigned getNumMisses() const {
+			std::lock_guard<std::mutex> guard(lock);
+			return misses;
+		}
+
+		std::ostream& printTo(std::ostream& out) const {
+			std::lock_guard<std::mutex> guard(lock);
+			unsigned total = hits + misses;
+			return out << name << ": " << entries.size() << " entries, " << hits << " hits, " << misses << " misses ("
+			           << (total ? (100 * hits / total) : 0) << "% hit rate)";
+		}
+	};
+
+	/**
+	 * The memo tables of the pure type operations (sub-typing, join/meet types, unification, type variable
+	 * instantiation and return type deduction). Each node manager maintains its own instance, covering the
+	 * types it manages. Types maintained by other managers are not memorized.
+	 */
+	struct TypeMemo : public utils::Printable {
+		MemoTable<std::pair<TypePtr, TypePtr>, bool> subTypes;
+		MemoTable<std::pair<TypePtr, TypePtr>, TypePtr> joinTypes;
+		MemoTable<std::pair<TypePtr, TypePtr>, TypePtr> meetTypes;
+		MemoTable<std::pair<TypePtr, TypePtr>, SubstitutionOpt> unifiers;
+		MemoTable<std::pair<TypeList, TypeList>, SubstitutionOpt> instantiations;
+		MemoTable<std::pair<FunctionTypePtr, TypeList>, TypePtr> returnTypes;
+
+		TypeMemo()
+		    : subTypes("isSubTypeOf"), joinTypes("getSmallestCommonSuperType"), meetTypes("getBiggestCommonSubType"), unifiers("unify"),
+		      instantiations("getTypeVariableInstantiation"), returnTypes("tryDeduceReturnType") {}
+
+		/**
+		 * Prints the hit rates of all tables.
+		 */
+		std::ostream& printTo(std::ostream& out) const {
+			return out << subTypes << "\n" << joinTypes << "\n" << meetTypes << "\n" << unifiers << "\n" << instantiations << "\n" << returnTypes;
+		}
+	};
+
+	/**
+	 * Determines whether results for the given nodes may be memorized within the memo of the given manager.
+	 */
+	inline bool isMemorizable(const NodeManager& manager, const NodePtr& node) {
+		return node && node->getNodeManagerPtr() == &manager;
+	}
+
+	template <typename... Nodes>
+	bool isMemorizable(const NodeManager& manager, const NodePtr& first, const Nodes&... rest) {
+		return isMemorizable(manager, first) && isMemorizable(manager, rest...);
+	}
+
+	template <typename T>
+	bool allMemorizable(const NodeManager& manager, const vector<T>& list) {
+		for(const auto& cur : list) {
+			if(!isMemorizable(manager, cur)) { return false; }
+		}
+		return true;
+	}
+
+} // end namespace types
+} // end namespace core
+} // end namespace insieme
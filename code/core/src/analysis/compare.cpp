@@ -126,7 +126,10 @@ namespace analysis {
 	}
 
 	bool equalNameless(const NodePtr& nodeA, const NodePtr& nodeB) {
-		return *nodeA == *nodeB || *wipeNames(nodeA) == *wipeNames(nodeB);
+		if(*nodeA == *nodeB) { return true; }
+		// renaming preserves the shape of the trees, thus differently shaped trees can not be equal
+		if(nodeA->getTreeSize() != nodeB->getTreeSize() || nodeA->getTreeDepth() != nodeB->getTreeDepth()) { return false; }
+		return *wipeNames(nodeA) == *wipeNames(nodeB);
 	}
 
 	namespace {
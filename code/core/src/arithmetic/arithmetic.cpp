@@ -122,6 +122,7 @@ namespace arithmetic {
 
 			// assemble the resulting elements
 			Container res;
+			res.reserve(a.size() + b.size());
 
 			auto it1 = a.begin();
 			auto end1 = a.end();
@@ -198,7 +199,7 @@ namespace arithmetic {
 		 */
 		bool lessThan(const NodePtr& a, const NodePtr& b) {
 			// check for identity
-			if(*a == *b) { return false; }
+			if(a == b || *a == *b) { return false; }
 
 			// handle types (compare string representation)
 			if(a->getNodeCategory() == NC_Type && b->getNodeCategory() == NC_Type) { return toString(*a) < toString(*b); }
@@ -376,6 +377,7 @@ namespace arithmetic {
 
 	Product Product::operator^(int exp) const {
 		vector<Factor> ret;
+		ret.reserve(factors.size());
 
 		for_each(factors, [&](const Factor& cur) { ret.push_back(Factor(cur.first, cur.second * exp)); });
 
@@ -529,6 +531,7 @@ namespace arithmetic {
 
 	const Formula Formula::operator-() const {
 		vector<Term> negTerms;
+		negTerms.reserve(terms.size());
 		for_each(terms, [&](const Term& cur) { negTerms.push_back(Term(cur.first, -cur.second)); });
 		return Formula(negTerms);
 	}
@@ -545,18 +548,28 @@ namespace arithmetic {
 
 	Formula& Formula::operator*=(const Formula& other) {
 		// compute cross-product of terms
-		Formula res;
-		for_each(terms, [&](const Term& a) {
-			for_each(other.terms, [&](const Term& b) {
-				const Product& A = a.first;
-				const Product& B = b.first;
-				const Rational& coeffA = a.second;
-				const Rational& coeffB = b.second;
-				Rational newCoeff = coeffA * coeffB;
-				if(!newCoeff.isZero()) { res += (A * B) * newCoeff; }
-			});
-		});
-		terms.swap(res.terms);
+		vector<Term> products;
+		products.reserve(terms.size() * other.terms.size());
+		for(const Term& a : terms) {
+			for(const Term& b : other.terms) {
+				Rational newCoeff = a.second * b.second;
+				if(!newCoeff.isZero()) { products.push_back(Term(a.first * b.first, newCoeff)); }
+			}
+		}
+
+		// sort the products and sum up the coefficients of equal products in a single pass
+		std::stable_sort(products.begin(), products.end(), [](const Term& a, const Term& b) { return a.first < b.first; });
+		vector<Term> res;
+		res.reserve(products.size());
+		for(Term& cur : products) {
+			if(res.empty() || !(res.back().first == cur.first)) {
+				res.push_back(std::move(cur));
+				continue;
+			}
+			res.back().second += cur.second;
+			if(res.back().second.isZero()) { res.pop_back(); }
+		}
+		terms.swap(res);
 		return *this;
 	}
 
@@ -181,9 +181,40 @@ namespace arithmetic {
 		return {};
 	}
 
+	namespace {
+
+		/**
+		 * The result of converting an expression into a formula, attached to the expression.
+		 * If the expression is not a formula, the cause reported by the conversion is retained.
+		 */
+		struct FormulaCache : public core::value_annotation::drop_on_clone {
+			Formula formula;
+			ExpressionPtr failure;
+			bool operator==(const FormulaCache& other) const {
+				return formula == other.formula && failure == other.failure;
+			}
+		};
+
+	} // end anonymous namespace
+
 	Formula toFormula(const ExpressionPtr& expr) {
+		// IR nodes are immutable, hence the conversion only has to be conducted once per expression
+		if(auto cache = expr->hasAttachedValue<FormulaCache>()) {
+			if(cache->failure) { throw NotAFormulaException(cache->failure); }
+			return cache->formula;
+		}
+
 		// the magic is done by the formula converter
-		return FormulaConverter(expr->getNodeManager().getLangBasic()).visit(expr);
+		FormulaCache cache;
+		try {
+			cache.formula = FormulaConverter(expr->getNodeManager().getLangBasic()).visit(expr);
+		} catch(const NotAFormulaException& nfe) {
+			cache.failure = (nfe.getCause()) ? nfe.getCause() : expr;
+			expr->attachValue(cache);
+			throw;
+		}
+		expr->attachValue(cache);
+		return cache.formula;
 	}
 
 	namespace {
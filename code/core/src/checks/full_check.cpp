@@ -35,6 +35,8 @@
  * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 
 #include "insieme/core/checks/full_check.h"
@@ -142,9 +144,13 @@ namespace checks {
 			// uncomment this to include the debug check
 //			context_free_checks.push_back(make_check<DebugCheck>());
 
-			// assemble the IR check list
+			// the number of threads to be used for checking nodes
+			unsigned numThreads = 1;
+			if(auto threads = getenv(INSIEME_SEMA_THREADS)) { numThreads = std::max(atoi(threads), 1); }
+
+			// assemble the IR check list - sub-DAGs found to be correct are skipped when being re-checked
 			return make_check<FullCheck>(combine(toVector<CheckPtr>(
-				makeVisitOnce(combine(context_free_checks)),
+				makeMemoized(combine(context_free_checks), numThreads),
 				make_check<FreeTagTypeReferencesCheck>()
 			)));
 		}
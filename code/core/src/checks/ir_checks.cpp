@@ -39,6 +39,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <thread>
 
 #include <boost/algorithm/string/replace.hpp>
 
@@ -47,6 +48,7 @@
 #include "insieme/core/dump/json_dump.h"
 #include "insieme/core/inspyer/inspyer.h"
 #include "insieme/utils/container_utils.h"
+#include "insieme/utils/id_generator.h"
 
 namespace insieme {
 namespace core {
@@ -127,6 +129,21 @@ namespace checks {
 
 	namespace {
 
+		/**
+		 * Adds the issues discovered when checking the given location to the given list,
+		 * correcting their locations accordingly.
+		 */
+		void addIssues(MessageList& res, const CodeLocation& loc, const OptionalMessageList& issues) {
+			if(!issues) { return; }
+			for(const Message& cur : issues->getAll()) {
+				auto newLoc = loc;
+				if (isChildOf(loc.getOrigin(), cur.getLocation().getOrigin())) {
+					newLoc.setOrigin(cur.getLocation().getOrigin());
+				}
+				res.add(Message(newLoc, cur.getErrorCode(), cur.getMessage(), cur.getType()));
+			}
+		}
+
 		/**
 		 * A check combining multiple AST Checks.
 		 */
@@ -270,18 +287,7 @@ namespace checks {
 
 				// now check all the locations
 				for(const auto& loc : locations) {
-					auto issues = check->visit(loc.getOrigin());
-
-					// correct locations
-					if(issues) {
-						for(const Message& cur : issues->getAll()) {
-							auto newLoc = loc;
-							if (isChildOf(loc.getOrigin(), cur.getLocation().getOrigin())) {
-								newLoc.setOrigin(cur.getLocation().getOrigin());
-							}
-							res.add(Message(newLoc, cur.getErrorCode(), cur.getMessage(), cur.getType()));
-						}
-					}
+					addIssues(res, loc, check->visit(loc.getOrigin()));
 				}
 
 				// -- experimental -- parallel version is disabled due to unsynchronized operations in the core -- experimental --
@@ -351,6 +357,163 @@ namespace checks {
 				}
 			}
 		};
+
+		/**
+		 * A value attached to nodes whose sub-DAG has been found to be free of issues. It lists the
+		 * IDs of the memoized checks which have confirmed this.
+		 */
+		struct CorrectSubDAGTag {
+			std::vector<unsigned> checks;
+			CorrectSubDAGTag(const std::vector<unsigned>& checks) : checks(checks) {}
+			bool operator==(const CorrectSubDAGTag& other) const {
+				return checks == other.checks;
+			}
+		};
+
+		/**
+		 * A check conducting AST Checks on every node once, like the VisitOnceIRCheck. Sub-DAGs found to
+		 * be free of issues are tagged and skipped by subsequent runs of the same instance, such that
+		 * re-checking a slightly modified program only checks the modified parts. Nodes may be checked
+		 * by multiple threads concurrently.
+		 */
+		class MemoizedIRCheck : public IRCheck {
+			/**
+			 * The generator for the IDs distinguishing the tags of different instances.
+			 */
+			static utils::ConcurrentIDGenerator<unsigned> idGenerator;
+
+			/**
+			 * The ID of this instance.
+			 */
+			unsigned id;
+
+			/**
+			 * The check to be conducted on all nodes.
+			 */
+			CheckPtr check;
+
+			/**
+			 * The number of threads to be utilized for checking nodes.
+			 */
+			unsigned numThreads;
+
+		  public:
+			/**
+			 * Creates a new instance conducting the given check using the given number of threads.
+			 */
+			MemoizedIRCheck(const CheckPtr& check, unsigned numThreads)
+				: IRCheck(check->isVisitingTypes()), id(idGenerator.getNext()), check(check), numThreads(std::max(numThreads, 1u)) {}
+
+		  protected:
+			OptionalMessageList visitNode(const NodeAddress& node) {
+				// collect the locations to be checked, skipping sub-DAGs known to be correct
+				NodeSet visited;
+				vector<CodeLocation> locations;
+				vector<NodePtr> postOrder;
+				collectLocations(node, visited, locations, postOrder);
+
+				// check all the locations - interleaved among the threads
+				vector<OptionalMessageList> issues(locations.size());
+				auto run = [&](unsigned first) {
+					for(std::size_t i = first; i < locations.size(); i += numThreads) {
+						issues[i] = check->visit(locations[i].getOrigin());
+					}
+				};
+				if(numThreads == 1 || locations.size() < 2) {
+					run(0);
+				} else {
+					vector<std::thread> threads;
+					for(unsigned i = 0; i < numThreads; i++) {
+						threads.emplace_back(run, i);
+					}
+					for(auto& cur : threads) {
+						cur.join();
+					}
+				}
+
+				// merge the results in the order of the locations
+				MessageList res;
+				NodeSet faulty;
+				for(std::size_t i = 0; i < locations.size(); i++) {
+					if(!issues[i] || issues[i]->empty()) { continue; }
+					faulty.insert(locations[i].getOrigin().getAddressedNode());
+					addIssues(res, locations[i], issues[i]);
+				}
+
+				// determine the correct sub-DAGs - nested nodes are processed before the enclosing nodes
+				NodeSet correct;
+				for(const auto& cur : postOrder) {
+					if(faulty.find(cur) != faulty.end()) { continue; }
+					if(all(getNestedNodes(cur), [&](const NodePtr& nested) { return isTagged(nested) || correct.find(nested) != correct.end(); })) {
+						correct.insert(cur);
+					}
+				}
+
+				// tag them to be skipped next time
+				for(const auto& cur : correct) {
+					auto ids = (cur->hasAttachedValue<CorrectSubDAGTag>()) ? cur->getAttachedValue<CorrectSubDAGTag>().checks : std::vector<unsigned>();
+					ids.push_back(id);
+					cur->attachValue<CorrectSubDAGTag>(ids);
+				}
+
+				// done
+				return (res.empty()) ? OptionalMessageList() : res;
+			}
+
+		  private:
+			bool isTagged(const NodePtr& node) const {
+				auto tag = node->hasAttachedValue<CorrectSubDAGTag>();
+				return tag && contains(tag->checks, id);
+			}
+
+			NodeList getNestedNodes(const NodePtr& node) const {
+				NodeList res = node->getChildList();
+				for(const auto& entry : node->getAnnotations()) {
+					for(const NodePtr& innerNode : entry.second->getChildNodes()) {
+						res.push_back(innerNode);
+					}
+				}
+				return res;
+			}
+
+			void collectLocations(const NodeAddress& cur, NodeSet& visited, vector<CodeLocation>& locations, vector<NodePtr>& postOrder) {
+				// check whether the node has been encountered before
+				if(!visited.insert(cur.getAddressedNode()).second) { return; }
+
+				// skip sub-DAGs confirmed to be correct by an earlier run
+				if(isTagged(cur.getAddressedNode())) { return; }
+
+				// add to list of targets (addresses)
+				locations.push_back(cur);
+
+				// also add locations within check-able annotations
+				auto annotations = cur->getAnnotations(); // annotations might mutate while iterating through them
+				for(const auto& entry : annotations) {
+					for(const NodePtr& innerNode : entry.second->getChildNodes()) {
+						assert_true(innerNode) << "Nodes must not be null!";
+
+						// create a inner list of locations
+						vector<CodeLocation> innerList;
+						collectLocations(NodeAddress(innerNode), visited, innerList, postOrder);
+
+						// merge inner list of locations with outer list
+						for(const auto& loc : innerList) {
+							locations.push_back(loc.shift(cur, entry.first));
+						}
+					}
+				}
+
+				// add child nodes
+				for(auto c : cur->getChildList()) {
+					collectLocations(c, visited, locations, postOrder);
+				}
+
+				// nested nodes have been processed
+				postOrder.push_back(cur.getAddressedNode());
+			}
+		};
+
+		utils::ConcurrentIDGenerator<unsigned> MemoizedIRCheck::idGenerator;
 	}
 
 	std::ostream& MessageList::printTo(std::ostream& out) const {
@@ -427,6 +590,8 @@ namespace checks {
 
 	CheckPtr makeVisitOnce(const CheckPtr& check) { return make_check<VisitOnceIRCheck>(check); }
 
+	CheckPtr makeMemoized(const CheckPtr& check, unsigned numThreads) { return make_check<MemoizedIRCheck>(check, numThreads); }
+
 	CheckPtr combine(const CheckPtr& a) { return combine(toVector<CheckPtr>(a)); }
 
 	CheckPtr combine(const CheckPtr& a, const CheckPtr& b) { return combine(toVector<CheckPtr>(a, b)); }
@@ -37,9 +37,17 @@
 
 #include "insieme/core/dump/binary_dump.h"
 
+#include <fcntl.h>
 #include <inttypes.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
 #include <limits>
 #include <map>
+#include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include "insieme/core/ir_visitor.h"
@@ -83,6 +91,30 @@ namespace binary {
 	//
 	// Within the binary file, every node of the DAG is only stored once
 	// and referenced via its index.
+	//
+	// The indexed format is storing the same node encodings, yet prefixed by
+	// a table of offsets to enable the random access to individual nodes:
+	//		<INDEXED_MAGIC_NUMBER> <VERSION> <NUM_CONVERTER> <CONVERTER_NAMES>+
+	//		<NUM_NODES> <NUM_ROOTS> <ROOT_INDEX>* <NODE_OFFSET>* <NODE>+
+	//
+	// where the offsets are 64-bit positions of the node encodings relative to
+	// the start of the dump. Nodes are thus only restored when being reached
+	// from one of the requested roots.
+	//
+	// The compact format is storing the DAG as a sequence of records, written
+	// while traversing the IR in post-order such that nodes are always preceded
+	// by their children:
+	//		<COMPACT_MAGIC_NUMBER> <VERSION> <RECORD>* <END> <ROOT_INDEX>
+	//
+	// All integers within records are LEB128 encoded. Every record starts with
+	// a tag, which is END, CONVERTER, ANNOTATION or the type of a node offset by
+	// the number of those special tags. Nodes are numbered in the order of their
+	// records and children are referenced by their distance to the referencing
+	// node. Strings are numbered in the order of their first occurrence and only
+	// stored there, every later occurrence is referencing the string's number.
+	// A CONVERTER record introduces the name of the next annotation converter,
+	// an ANNOTATION record attaches the annotation encoded by a previous node
+	// to another previous node using a previously introduced converter.
 
 
 	namespace {
@@ -184,6 +216,46 @@ namespace binary {
 				}
 			}
 
+			/**
+			 * Dumps the given list of root nodes into the given output stream using the indexed format.
+			 */
+			void dumpIndexed(std::ostream& out, const NodeList& roots) {
+				// create node list and index
+				for(const auto& cur : roots) {
+					createIndex(cur);
+				}
+
+				// encode the nodes to determine their offsets
+				std::stringstream nodes(std::ios_base::out | std::ios_base::in | std::ios_base::binary);
+				vector<uint64_t> offsets;
+				for(auto cur : nodeList) {
+					offsets.push_back(nodes.tellp());
+					dumpNode(nodes, cur);
+				}
+
+				// encode the header
+				std::stringstream header(std::ios_base::out | std::ios_base::in | std::ios_base::binary);
+				write(header, INDEXED_MAGIC_NUMBER);
+				write(header, INDEXED_FORMAT_VERSION);
+				write<index_t>(header, converter.size());
+				for(auto cur : converter) {
+					dumpConverter(header, cur);
+				}
+				write<index_t>(header, nodeList.size());
+				write<index_t>(header, roots.size());
+				for(const auto& cur : roots) {
+					write<index_t>(header, index[cur].first);
+				}
+
+				// write header, offset table and nodes
+				uint64_t base = (uint64_t)header.tellp() + sizeof(uint64_t) * offsets.size();
+				out << header.rdbuf();
+				for(auto cur : offsets) {
+					write<uint64_t>(out, base + cur);
+				}
+				out << nodes.rdbuf();
+			}
+
 		  private:
 			/**
 			 * Dumps a single annotation converter instance (the name of the converter).
@@ -316,43 +388,167 @@ namespace binary {
 			}
 		};
 
+		// the special tags of the records within the compact format
+		enum CompactTag { TAG_END = 0, TAG_CONVERTER = 1, TAG_ANNOTATION = 2, NUM_SPECIAL_TAGS = 3 };
+
+		uint64_t zigzag(int value) {
+			return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+		}
+
+		int unzigzag(uint64_t value) {
+			return (int)((uint32_t)(value >> 1) ^ (uint32_t)(-(int64_t)(value & 1)));
+		}
+
 		/**
-		 * The binary loader is restoring an IR structure from a binary input stream.
+		 * The compact dumper is writing the compact format while traversing the IR. Nodes are
+		 * written as soon as all their children have been written, thus only the index of the
+		 * nodes written so far needs to be maintained.
 		 */
-		class BinaryLoader {
+		class CompactDumper {
 			/**
-			 * A simple data structure summarizing the information extracted from
-			 * an encoded node before restoring it.
+			 * The stream to be writing to.
 			 */
-			struct NodeInfo {
-				/**
-				 * The list of indices referencing the child nodes of a node.
-				 */
-				vector<index_t> children;
+			std::ostream& out;
 
-				/**
-				 * The list of annotations of a node - the converter index followed
-				 * by the root node index.
-				 */
-				vector<pair<index_t, index_t>> annotations;
-			};
+			/**
+			 * The register of annotation converters to be utilized for the encoding.
+			 */
+			const AnnotationConverterRegister& converterRegister;
 
 			/**
-			 * The builder used to construct nodes.
+			 * The index of all nodes written so far.
 			 */
-			IRBuilder builder;
+			std::unordered_map<const Node*, uint64_t> index;
 
 			/**
-			 * A list of node skeletons extracted while passing through
-			 * the the file. The first vector lists all child nodes, the second
-			 * vector all annotations.
+			 * The index of all strings written so far.
 			 */
-			vector<pair<NodeType, NodeInfo>> nodes;
+			std::unordered_map<string, uint64_t> strings;
 
 			/**
-			 * The index of all resolved nodes.
+			 * The index of all converters introduced so far.
 			 */
-			vector<NodePtr> index;
+			std::map<AnnotationConverterPtr, uint64_t> converters;
+
+		  public:
+			CompactDumper(std::ostream& out, const AnnotationConverterRegister& converterRegister) : out(out), converterRegister(converterRegister) {}
+
+			void dump(const NodePtr& ir) {
+				write(out, COMPACT_MAGIC_NUMBER);
+				write(out, COMPACT_FORMAT_VERSION);
+				uint64_t root = dumpDAG(ir);
+				writeVarint(out, TAG_END);
+				writeVarint(out, root);
+			}
+
+		  private:
+			/**
+			 * Writes all nodes of the given DAG not written so far and returns the index of its root.
+			 */
+			uint64_t dumpDAG(const NodePtr& root) {
+				// a post-order traversal using an explicit stack, since the IR may be deep
+				vector<pair<NodePtr, std::size_t>> stack;
+				stack.push_back({root, 0});
+				while(!stack.empty()) {
+					auto& top = stack.back();
+					const NodeList& children = top.first->getChildList();
+
+					// descent into the next child not written so far
+					if(top.second < children.size()) {
+						const NodePtr& child = children[top.second++];
+						if(index.find(&*child) == index.end()) { stack.push_back({child, 0}); }
+						continue;
+					}
+
+					// all children have been written, so the node can be written as well
+					NodePtr node = top.first;
+					stack.pop_back();
+					if(index.find(&*node) != index.end()) { continue; } // written by an annotation in the meanwhile
+					dumpNode(node);
+					dumpAnnotations(node);
+				}
+				return index[&*root];
+			}
+
+			void dumpNode(const NodePtr& node) {
+				uint64_t pos = index.size();
+				NodeType type = node->getNodeType();
+				writeVarint(out, type + NUM_SPECIAL_TAGS);
+
+				if(type == NT_StringValue) {
+					dumpString(node.as<StringValuePtr>()->getValue());
+				} else if(type == NT_BoolValue) {
+					writeVarint(out, node.as<BoolValuePtr>()->getValue() ? 1 : 0);
+				} else if(type == NT_CharValue) {
+					writeVarint(out, (uint8_t)node.as<CharValuePtr>()->getValue());
+				} else if(type == NT_IntValue) {
+					writeVarint(out, zigzag(node.as<IntValuePtr>()->getValue()));
+				} else if(type == NT_UIntValue) {
+					writeVarint(out, node.as<UIntValuePtr>()->getValue());
+				} else {
+					const NodeList& children = node->getChildList();
+					writeVarint(out, children.size());
+					for(const auto& cur : children) {
+						writeVarint(out, pos - index[&*cur]);
+					}
+				}
+
+				index[&*node] = pos;
+			}
+
+			void dumpString(const string& str) {
+				auto pos = strings.find(str);
+				if(pos != strings.end()) {
+					writeVarint(out, pos->second);
+					return;
+				}
+
+				// the first occurrence is introducing the string
+				uint64_t id = strings.size();
+				strings[str] = id;
+				writeVarint(out, id);
+				writeVarint(out, str.length());
+				out.write(str.c_str(), str.length());
+			}
+
+			void dumpAnnotations(const NodePtr& node) {
+				if(!node->hasAnnotations()) { return; }
+				NodeManager& mgr = node->getNodeManager();
+				for(auto cur : node->getAnnotations()) {
+					auto converter = converterRegister.getConverterFor(cur.second);
+					if(!converter) { continue; }
+
+					// write the converted annotation
+					NodePtr converted = converter->toIR(mgr, cur.second);
+					assert_true(converted) << "Converted Annotation must not be NULL!";
+					uint64_t root = dumpDAG(converted);
+
+					// introduce the converter if necessary
+					auto pos = converters.find(converter);
+					if(pos == converters.end()) {
+						pos = converters.insert({converter, converters.size()}).first;
+						writeVarint(out, TAG_CONVERTER);
+						writeVarint(out, converter->getName().length());
+						out.write(converter->getName().c_str(), converter->getName().length());
+					}
+
+					// attach the annotation
+					writeVarint(out, TAG_ANNOTATION);
+					writeVarint(out, index.size() - index[&*node]);
+					writeVarint(out, index.size() - root);
+					writeVarint(out, pos->second);
+				}
+			}
+		};
+
+		/**
+		 * The compact loader is restoring an IR structure from a stream of records of the compact format.
+		 */
+		class CompactLoader {
+			/**
+			 * The builder used to construct nodes.
+			 */
+			IRBuilder builder;
 
 			/**
 			 * The register of annotation converters to be utilized for the decoding.
@@ -360,147 +556,276 @@ namespace binary {
 			const AnnotationConverterRegister& converterRegister;
 
 			/**
-			 * The index of the converters used to restore the annotations within the
-			 * binary file as specified within the header.
+			 * The nodes restored so far, in the order of their records.
 			 */
-			vector<AnnotationConverterPtr> converter_index;
+			vector<NodePtr> nodes;
 
-		  public:
-			BinaryLoader(NodeManager& manager, const AnnotationConverterRegister& converterRegister) : builder(manager), converterRegister(converterRegister) {}
+			/**
+			 * The strings introduced so far.
+			 */
+			vector<string> strings;
 
-			NodePtr load(std::istream& in) {
-				// check magic number
-				if(read<uint64_t>(in) != MAGIC_NUMBER) { throw InvalidEncodingException("Encoding error: wrong magic number!"); }
+			/**
+			 * The converters introduced so far.
+			 */
+			vector<AnnotationConverterPtr> converters;
 
-				// load converter list
-				loadConverter(in);
+		  public:
+			CompactLoader(NodeManager& manager, const AnnotationConverterRegister& converterRegister) : builder(manager), converterRegister(converterRegister) {}
 
-				// load index
-				loadIndex(in);
+			/**
+			 * Restores the IR from the given stream, positioned right after the magic number.
+			 */
+			NodePtr load(std::istream& in) {
+				// check version
+				if(read<uint32_t>(in) != COMPACT_FORMAT_VERSION) { throw InvalidEncodingException("Encoding error: unsupported format version!"); }
+
+				// process records
+				for(uint64_t tag = readVarint(in); tag != TAG_END; tag = readVarint(in)) {
+					if(!in) { throw InvalidEncodingException("Encoding error: unexpected end of stream!"); }
+
+					if(tag == TAG_CONVERTER) {
+						converters.push_back(converterRegister.getConverterFor(loadString(in)));
+					} else if(tag == TAG_ANNOTATION) {
+						NodePtr node = getPrevious(readVarint(in));
+						ExpressionPtr encoded = getPrevious(readVarint(in)).as<ExpressionPtr>();
+						uint64_t converter = readVarint(in);
+						if(converter >= converters.size()) { throw InvalidEncodingException("Encoding error: unknown converter!"); }
+						if(converters[converter]) { converters[converter]->attachAnnotation(node, encoded); }
+					} else if(tag - NUM_SPECIAL_TAGS < NUM_CONCRETE_NODE_TYPES) {
+						loadNode(NodeType(tag - NUM_SPECIAL_TAGS), in);
+					} else {
+						throw InvalidEncodingException("Encoding error: invalid record!");
+					}
+				}
 
-				// restore nodes
-				NodePtr res = resolve(0); // root node has always index 0
+				// obtain the root
+				uint64_t root = readVarint(in);
+				if(!in || root >= nodes.size()) { throw InvalidEncodingException("Encoding error: invalid root!"); }
+				return nodes[root];
+			}
 
-				// restore annotations
-				resolveAnnotations();
+		  private:
+			NodePtr getPrevious(uint64_t distance) {
+				if(distance == 0 || distance > nodes.size()) { throw InvalidEncodingException("Encoding error: invalid node reference!"); }
+				return nodes[nodes.size() - distance];
+			}
 
+			string loadString(std::istream& in) {
+				uint64_t length = readVarint(in);
+				string res(length, '\0');
+				in.read(&res[0], length);
 				return res;
 			}
 
-		  private:
-			string loadString(std::istream& in) {
-				// load string
-				length_t length = read<length_t>(in);
+			void loadNode(NodeType type, std::istream& in) {
+				if(type == NT_StringValue) {
+					uint64_t id = readVarint(in);
+					if(id == strings.size()) {
+						strings.push_back(loadString(in));
+					} else if(id > strings.size()) {
+						throw InvalidEncodingException("Encoding error: invalid string reference!");
+					}
+					nodes.push_back(builder.stringValue(strings[id]));
+				} else if(type == NT_BoolValue) {
+					nodes.push_back(builder.boolValue(readVarint(in) != 0));
+				} else if(type == NT_CharValue) {
+					nodes.push_back(builder.charValue((char)readVarint(in)));
+				} else if(type == NT_IntValue) {
+					nodes.push_back(builder.intValue(unzigzag(readVarint(in))));
+				} else if(type == NT_UIntValue) {
+					nodes.push_back(builder.uintValue((unsigned)readVarint(in)));
+				} else {
+					uint64_t length = readVarint(in);
+					NodeList children;
+					children.reserve(length);
+					for(uint64_t i = 0; i < length; i++) {
+						children.push_back(getPrevious(readVarint(in)));
+					}
+					nodes.push_back(builder.get(type, children));
+				}
+			}
+		};
 
-				// load string
-				char data[length + 1];
-				in.read(data, length);
-				data[length] = '\0';
+		/**
+		 * A simple data structure summarizing the information extracted from
+		 * an encoded node before restoring it.
+		 */
+		struct NodeInfo {
+			/**
+			 * The type of the encoded node.
+			 */
+			NodeType type;
 
-				// register string value
-				return string(data, length);
-			}
+			/**
+			 * The restored node in case it is a value node, null otherwise.
+			 */
+			NodePtr value;
 
-			void loadConverter(std::istream& in) {
-				// get number of converters
-				index_t numConverter;
-				in.read((char*)&numConverter, sizeof(numConverter));
+			/**
+			 * The list of indices referencing the child nodes of a node.
+			 */
+			vector<index_t> children;
 
-				// load converters
-				for(index_t i = 0; i < numConverter; i++) {
-					auto converterName = loadString(in);
-					converter_index.push_back(converterRegister.getConverterFor(converterName));
-				}
+			/**
+			 * The list of annotations of a node - the converter index followed
+			 * by the root node index.
+			 */
+			vector<pair<index_t, index_t>> annotations;
+		};
+
+		string loadString(std::istream& in) {
+			// load string
+			length_t length = read<length_t>(in);
+
+			// load string
+			string res(length, '\0');
+			in.read(&res[0], length);
+			return res;
+		}
+
+		void loadConverter(std::istream& in, const AnnotationConverterRegister& converterRegister, vector<AnnotationConverterPtr>& converter_index) {
+			// get number of converters
+			index_t numConverter = read<index_t>(in);
+
+			// load converters
+			for(index_t i = 0; i < numConverter; i++) {
+				auto converterName = loadString(in);
+				converter_index.push_back(converterRegister.getConverterFor(converterName));
 			}
+		}
 
-			void loadIndex(std::istream& in) {
-				// load number of nodes
-				index_t numNodes;
-				in.read((char*)&numNodes, sizeof(numNodes));
+		void loadAnnotations(std::istream& in, NodeInfo& info) {
+			// get number of annotations
+			length_t numAnnotations = read<length_t>(in);
 
-				// allocate sufficient space
-				nodes.resize(numNodes);
-				index.resize(numNodes);
+			for(length_t i = 0; i < numAnnotations; i++) {
+				// read current annotation information
+				index_t converterID = read<index_t>(in);
+				index_t rootIndex = read<index_t>(in);
 
-				// resolve nodes
-				for(index_t i = 0; i < numNodes; i++) {
-					loadNode(i, in);
-				}
+				// add information to node skeletons
+				info.annotations.push_back(std::make_pair(converterID, rootIndex));
 			}
+		}
+
+		/**
+		 * Decodes a single node from the given input stream. Value nodes are restored
+		 * immediately using the given builder.
+		 */
+		void loadNode(std::istream& in, IRBuilder& builder, NodeInfo& info) {
+			// load node type
+			type_t type = read<type_t>(in);
+			info.type = NodeType(type);
+
+			if(type == NT_StringValue) {
+				// load and register string value
+				info.value = builder.stringValue(loadString(in));
 
-			void loadAnnotations(index_t pos, std::istream& in) {
-				// get list of annotations
-				vector<index_t> annotations;
+				// load annotations
+				loadAnnotations(in, info);
 
-				// get number of annotations
-				length_t numAnnotations = read<length_t>(in);
+				return;
+			}
 
-				for(length_t i = 0; i < numAnnotations; i++) {
-					// read current annotation information
-					index_t converterID = read<index_t>(in);
-					index_t rootIndex = read<index_t>(in);
 
-					// add information to node skeletons
-					nodes[pos].second.annotations.push_back(std::make_pair(converterID, rootIndex));
+			// handle value node
+			if(type == NT_BoolValue || type == NT_CharValue || type == NT_IntValue || type == NT_UIntValue) {
+				if(type == NT_BoolValue) {
+					info.value = builder.boolValue(bool(read<uint8_t>(in) != 0));
+				} else if(type == NT_CharValue) {
+					info.value = builder.charValue(char(read<uint8_t>(in)));
+				} else if(type == NT_UIntValue) {
+					info.value = builder.uintValue(unsigned(read<uint32_t>(in)));
+				} else if(type == NT_IntValue) {
+					info.value = builder.intValue(int(read<int32_t>(in)));
+				} else {
+					assert_fail() << "Inconsistent code!";
 				}
+
+				// load annotations
+				loadAnnotations(in, info);
+
+				return;
 			}
 
-			void loadNode(index_t pos, std::istream& in) {
-				// load node type
-				type_t type;
-				in.read((char*)&type, sizeof(type));
+			// restore all other nodes
+			length_t length = read<length_t>(in);
+			for(length_t i = 0; i < length; i++) {
+				info.children.push_back(read<index_t>(in));
+			}
 
-				// create node-index entry
-				nodes[pos].first = NodeType(type); // child list and annotations are default-initialized
+			// load annotations
+			loadAnnotations(in, info);
+		}
 
-				if(type == NT_StringValue) {
-					// load and register string value
-					index[pos] = builder.stringValue(loadString(in));
+		/**
+		 * The binary loader is restoring an IR structure from a binary input stream.
+		 */
+		class BinaryLoader {
+			/**
+			 * The builder used to construct nodes.
+			 */
+			IRBuilder builder;
 
-					// load annotations
-					loadAnnotations(pos, in);
+			/**
+			 * A list of node skeletons extracted while passing through
+			 * the the file.
+			 */
+			vector<NodeInfo> nodes;
 
-					return;
-				}
+			/**
+			 * The index of all resolved nodes.
+			 */
+			vector<NodePtr> index;
 
+			/**
+			 * The register of annotation converters to be utilized for the decoding.
+			 */
+			const AnnotationConverterRegister& converterRegister;
 
-				// handle value node
-				if(type == NT_BoolValue || type == NT_CharValue || type == NT_IntValue || type == NT_UIntValue) {
-					ValuePtr value;
-					if(type == NT_BoolValue) {
-						value = builder.boolValue(bool(read<uint8_t>(in) != 0));
-					} else if(type == NT_CharValue) {
-						value = builder.charValue(char(read<uint8_t>(in)));
-					} else if(type == NT_UIntValue) {
-						value = builder.uintValue(unsigned(read<uint32_t>(in)));
-					} else if(type == NT_IntValue) {
-						value = builder.intValue(int(read<int32_t>(in)));
-					} else {
-						assert_fail() << "Inconsistent code!";
-					}
+			/**
+			 * The index of the converters used to restore the annotations within the
+			 * binary file as specified within the header.
+			 */
+			vector<AnnotationConverterPtr> converter_index;
 
-					// register value
-					index[pos] = value;
+		  public:
+			BinaryLoader(NodeManager& manager, const AnnotationConverterRegister& converterRegister) : builder(manager), converterRegister(converterRegister) {}
 
-					// load annotations
-					loadAnnotations(pos, in);
+			/**
+			 * Restores the IR from the given stream, positioned right after the magic number.
+			 */
+			NodePtr load(std::istream& in) {
+				// load converter list
+				loadConverter(in, converterRegister, converter_index);
 
-					return;
-				}
+				// load index
+				loadIndex(in);
 
-				// restore all other nodes
-				length_t length = read<length_t>(in);
+				// restore nodes
+				NodePtr res = resolve(0); // root node has always index 0
 
-				vector<index_t> children;
-				for(length_t i = 0; i < length; i++) {
-					children.push_back(read<index_t>(in));
-				}
+				// restore annotations
+				resolveAnnotations();
 
-				// add child list
-				nodes[pos].second.children = children;
+				return res;
+			}
 
-				// load annotations
-				loadAnnotations(pos, in);
+		  private:
+			void loadIndex(std::istream& in) {
+				// load number of nodes
+				index_t numNodes = read<index_t>(in);
+
+				// allocate sufficient space
+				nodes.resize(numNodes);
+				index.resize(numNodes);
+
+				// resolve nodes
+				for(index_t i = 0; i < numNodes; i++) {
+					loadNode(in, builder, nodes[i]);
+					index[i] = nodes[i].value;
+				}
 			}
 
 			NodePtr resolve(index_t pos) {
@@ -508,8 +833,8 @@ namespace binary {
 				if(index[pos]) { return index[pos]; }
 
 				// resolve child list
-				NodeList children = ::transform(nodes[pos].second.children, fun(*this, &BinaryLoader::resolve));
-				NodePtr res = builder.get(nodes[pos].first, children);
+				NodeList children = ::transform(nodes[pos].children, fun(*this, &BinaryLoader::resolve));
+				NodePtr res = builder.get(nodes[pos].type, children);
 
 				// remember newly resolved node
 				index[pos] = res;
@@ -520,7 +845,7 @@ namespace binary {
 				// restore all annotations
 				for(index_t i = 0; i < nodes.size(); i++) {
 					NodePtr node = resolve(i);
-					for(auto cur : nodes[i].second.annotations) {
+					for(auto cur : nodes[i].annotations) {
 						// restores the encoding of the annotations
 						ExpressionPtr encoded = resolve(cur.second).as<ExpressionPtr>();
 
@@ -532,6 +857,15 @@ namespace binary {
 			}
 		};
 
+		/**
+		 * A read-only stream buffer operating on a fixed memory region.
+		 */
+		struct MemoryBuffer : public std::streambuf {
+			MemoryBuffer(const char* begin, const char* end) {
+				setg(const_cast<char*>(begin), const_cast<char*>(begin), const_cast<char*>(end));
+			}
+		};
+
 		void dumpPathIndices(std::ostream& out, const NodeAddress::Path& path) {
 			// dump in order
 			if(path.getLength() > 2) { dumpPathIndices(out, path.getPathToParent()); }
@@ -566,7 +900,128 @@ namespace binary {
 	}
 
 
+	void dumpIndexedIR(std::ostream& out, const NodeList& roots, const AnnotationConverterRegister& converterRegister) {
+		BinaryDumper(converterRegister).dumpIndexed(out, roots);
+	}
+
+	bool isIndexedIR(std::istream& in) {
+		auto pos = in.tellg();
+		bool res = read<uint64_t>(in) == INDEXED_MAGIC_NUMBER;
+		in.clear();
+		in.seekg(pos);
+		return res;
+	}
+
+	LazyIRLoader::LazyIRLoader(NodeManager& manager, const std::string& data, const AnnotationConverterRegister& converterRegister)
+	    : LazyIRLoader(manager, std::make_shared<const std::string>(data), converterRegister) {}
+
+	LazyIRLoader::LazyIRLoader(NodeManager& manager, const std::shared_ptr<const std::string>& data, const AnnotationConverterRegister& converterRegister)
+	    : LazyIRLoader(manager, data, data->data(), data->size(), converterRegister) {}
+
+	LazyIRLoader::LazyIRLoader(NodeManager& manager, const std::shared_ptr<const void>& storage, const char* data, std::size_t size,
+	                           const AnnotationConverterRegister& converterRegister)
+	    : storage(storage), data(data), size(size), manager(manager), offsets(nullptr), numMaterialized(0) {
+		MemoryBuffer buffer(data, data + size);
+		std::istream in(&buffer);
+
+		// check magic number and version
+		if(read<uint64_t>(in) != INDEXED_MAGIC_NUMBER) { throw InvalidEncodingException("Encoding error: wrong magic number!"); }
+		if(read<uint32_t>(in) != INDEXED_FORMAT_VERSION) { throw InvalidEncodingException("Encoding error: unsupported format version!"); }
+
+		// load converter list
+		loadConverter(in, converterRegister, converter_index);
+
+		// load the list of roots
+		index_t numNodes = read<index_t>(in);
+		index_t numRoots = read<index_t>(in);
+		for(index_t i = 0; i < numRoots; i++) {
+			roots.push_back(read<index_t>(in));
+		}
+
+		// locate the offset table
+		if(!in) { throw InvalidEncodingException("Encoding error: truncated header!"); }
+		std::size_t pos = in.tellg();
+		if(pos + sizeof(uint64_t) * numNodes > size) { throw InvalidEncodingException("Encoding error: truncated offset table!"); }
+		offsets = data + pos;
+		index.resize(numNodes);
+	}
+
+	std::unique_ptr<LazyIRLoader> LazyIRLoader::mapFile(NodeManager& manager, const std::string& file, std::size_t offset,
+	                                                    const AnnotationConverterRegister& converterRegister) {
+		int fd = open(file.c_str(), O_RDONLY);
+		if(fd < 0) { throw InvalidEncodingException("Unable to open file " + file); }
+
+		// determine the size of the file
+		struct stat info;
+		if(fstat(fd, &info) != 0 || (std::size_t)info.st_size <= offset) {
+			close(fd);
+			throw InvalidEncodingException("Unable to map file " + file);
+		}
+		std::size_t size = info.st_size;
+
+		// map the file - the mapping remains valid after closing the file descriptor
+		void* base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if(base == MAP_FAILED) { throw InvalidEncodingException("Unable to map file " + file); }
+
+		std::shared_ptr<const void> storage(base, [size](const void* ptr) { munmap(const_cast<void*>(ptr), size); });
+		return std::unique_ptr<LazyIRLoader>(new LazyIRLoader(manager, storage, (const char*)base + offset, size - offset, converterRegister));
+	}
+
+	NodePtr LazyIRLoader::getRoot(std::size_t i) {
+		assert_lt(i, roots.size()) << "Root index out of bound!";
+		return resolve(roots[i]);
+	}
+
+	NodePtr LazyIRLoader::resolve(index_t pos) {
+		if(pos >= index.size()) { throw InvalidEncodingException("Encoding error: node index out of bound!"); }
+
+		// check whether node has been resolved before
+		if(index[pos]) { return index[pos]; }
+
+		// locate the encoding of the node
+		uint64_t offset;
+		std::memcpy(&offset, offsets + sizeof(uint64_t) * pos, sizeof(offset));
+		if(offset >= size) { throw InvalidEncodingException("Encoding error: node offset out of bound!"); }
+
+		// decode the node
+		IRBuilder builder(manager);
+		MemoryBuffer buffer(data + offset, data + size);
+		std::istream in(&buffer);
+		NodeInfo info;
+		loadNode(in, builder, info);
+
+		// resolve the child list of non-value nodes
+		NodePtr res = info.value;
+		if(!res) {
+			NodeList children = ::transform(info.children, [&](index_t cur) { return resolve(cur); });
+			res = builder.get(info.type, children);
+		}
+
+		// remember newly resolved node before restoring annotations, which may refer to it
+		index[pos] = res;
+		numMaterialized++;
+
+		// restore annotations
+		for(auto cur : info.annotations) {
+			ExpressionPtr encoded = resolve(cur.second).as<ExpressionPtr>();
+			AnnotationConverterPtr converter = (cur.first < converter_index.size()) ? converter_index[cur.first] : AnnotationConverterPtr();
+			if(converter) { converter->attachAnnotation(res, encoded); }
+		}
+
+		return res;
+	}
+
+	void dumpCompactIR(std::ostream& out, const NodePtr& ir, const AnnotationConverterRegister& converterRegister) {
+		CompactDumper(out, converterRegister).dump(ir);
+	}
+
 	NodePtr loadIR(std::istream& in, core::NodeManager& manager, const AnnotationConverterRegister& converterRegister) {
+		// check magic number to determine the format
+		uint64_t magic = read<uint64_t>(in);
+		if(magic == COMPACT_MAGIC_NUMBER) { return CompactLoader(manager, converterRegister).load(in); }
+		if(magic != MAGIC_NUMBER) { throw InvalidEncodingException("Encoding error: wrong magic number!"); }
+
 		return BinaryLoader(manager, converterRegister).load(in);
 	}
 
@@ -51,6 +51,29 @@ namespace utils {
 		out.write(str.c_str(), str.length());
 	}
 
+	void writeVarint(std::ostream& out, uint64_t value) {
+		while(value >= 0x80) {
+			out.put((char)((value & 0x7f) | 0x80));
+			value >>= 7;
+		}
+		out.put((char)value);
+	}
+
+	uint64_t readVarint(std::istream& in) {
+		uint64_t res = 0;
+		auto buffer = in.rdbuf();
+		for(unsigned shift = 0; shift < 64; shift += 7) {
+			auto cur = buffer->sbumpc();
+			if(cur == std::char_traits<char>::eof()) {
+				in.setstate(std::ios::eofbit | std::ios::failbit);
+				return 0;
+			}
+			res |= (uint64_t)(cur & 0x7f) << shift;
+			if(!(cur & 0x80)) { return res; }
+		}
+		return res;
+	}
+
 } // end namespace utils
 } // end namespace binary
 } // end namespace dump
@@ -37,6 +37,8 @@
 
 #include "insieme/core/ir_node.h"
 
+#include <unordered_set>
+
 #include "insieme/core/ir_builder.h"
 #include "insieme/core/ir_mapper.h"
 #include "insieme/core/ir_node_annotation.h"
@@ -53,6 +55,8 @@
 #include "insieme/core/lang/basic.h"
 #include "insieme/core/lang/extension.h"
 
+#include "insieme/core/types/type_memo.h"
+
 #include "insieme/utils/container_utils.h"
 
 #include "insieme/common/env_vars.h"
@@ -68,35 +72,10 @@ namespace core {
 	/**
 	 * Defining the equality ID generator.
 	 */
-	utils::SimpleIDGenerator<Node::EqualityID> Node::equalityClassIDGenerator;
+	utils::ConcurrentIDGenerator<Node::EqualityID> Node::equalityClassIDGenerator;
 
 	namespace detail {
 
-		/**
-		 * A visitor realizing the hashing for the value type potentially stored
-		 * within a node.
-		 */
-		struct HashVisitor : public boost::static_visitor<std::size_t> {
-			template <typename T>
-			std::size_t operator()(const T& value) const {
-				return boost::hash<T>()(value);
-			}
-
-			// hashing of integer values by according to http://www.concentric.net/~ttwang/tech/inthash.htm
-
-			std::size_t operator()(const char value) const {
-				return static_cast<std::size_t>(value * 2654435761);
-			}
-
-			std::size_t operator()(const int value) const {
-				return static_cast<std::size_t>(value * 2654435761);
-			}
-
-			std::size_t operator()(const unsigned value) const {
-				return static_cast<std::size_t>(value * 2654435761);
-			}
-		};
-
 		/**
 		 * Obtains a hash value for the given value instance.
 		 *
@@ -126,8 +105,25 @@ namespace core {
 	}
 
 	Node::Node(const NodeType nodeType, const NodeValue& value)
-	    : HashableImmutableData(detail::hash(nodeType, value)), nodeType(nodeType), value(value), nodeCategory(NC_Value), manager(0), equalityID(0) {}
-
+	    : HashableImmutableData(detail::hash(nodeType, value)), nodeType(nodeType), value(value), nodeCategory(NC_Value), manager(0), equalityID(0),
+	      treeSize(1), treeDepth(1), dagSize(0) {}
+
+
+	uint64_t Node::computeDAGSize() const {
+		// an iterative traversal, since DAGs may be deeper than the call stack permits
+		std::unordered_set<const Node*> visited;
+		std::vector<const Node*> pending;
+		pending.push_back(this);
+		visited.insert(this);
+		while(!pending.empty()) {
+			const Node* cur = pending.back();
+			pending.pop_back();
+			for(const auto& child : cur->children) {
+				if(visited.insert(&*child).second) { pending.push_back(&*child); }
+			}
+		}
+		return visited.size();
+	}
 
 	const Node* Node::cloneTo(NodeManager& manager) const {
 		static const NodeList emptyList;
@@ -143,7 +139,7 @@ namespace core {
 		// create a clone using children within the new manager
 		Node* res;
 		if(isValueInternal()) {
-			res = createInstanceUsing(emptyList);
+			res = createInstanceUsing(emptyList, manager.getArena());
 		} else {
 			// clone the child list
 			auto clonedChildList = manager.getAll(getChildListInternal());
@@ -156,7 +152,7 @@ namespace core {
 			}
 
 			// otherwise: create a new node
-			res = createInstanceUsing(clonedChildList);
+			res = createInstanceUsing(clonedChildList, manager.getArena());
 		}
 
 		// update manager
@@ -210,7 +206,7 @@ namespace core {
 		}
 	}
 
-	NodeManager::NodeManager() : data(new NodeManagerData(*this)) {
+	NodeManager::NodeManager() : data(new NodeManagerData(*this)), typeMemo(std::make_shared<types::TypeMemo>()) {
 		// set the abort node if the env var is set
 		if(auto nodeIrString = getenv(INSIEME_ABORT_NODE)) {
 			data->abortNode = &(*IRBuilder(*this).parse(nodeIrString));
@@ -218,9 +214,10 @@ namespace core {
 		}
 	}
 
-	NodeManager::NodeManager(NodeManager& manager) : InstanceManager<Node, Pointer, AbortOnNodeCreation, MoveAnnotationOnClone>(manager), data(manager.data) { }
+	NodeManager::NodeManager(NodeManager& manager) : InstanceManager<Node, Pointer, AbortOnNodeCreation, MoveAnnotationOnClone>(manager), data(manager.data),
+	                                                typeMemo(std::make_shared<types::TypeMemo>()) { }
 
-	NodeManager::NodeManager(unsigned initialFreshID) : data(new NodeManagerData(*this)) {
+	NodeManager::NodeManager(unsigned initialFreshID) : data(new NodeManagerData(*this)), typeMemo(std::make_shared<types::TypeMemo>()) {
 		setNextFreshID(initialFreshID);
 	}
 
@@ -36,6 +36,7 @@
  */
 
 #include <cinttypes>
+#include <unordered_set>
 
 #include "insieme/core/ir_node.h"
 #include "insieme/core/ir_visitor.h"
@@ -49,50 +50,19 @@ namespace core {
 
 	namespace {
 
-		/**
-		 * A utility for the efficient computation of a IR programs height.
-		 */
-		unsigned getHeight(const NodePtr& node, std::map<NodePtr,unsigned>& cache) {
-
-			// check cache
-			auto pos = cache.find(node);
-			if (pos != cache.end()) return pos->second;
-
-			// evaluate depth
-			unsigned res = 0;
-			for(const auto& cur : node->getChildList()) {
-				res = std::max(res,getHeight(cur,cache));
-			}
-
-			// cache result and return value
-			return cache[node] = res + 1;
-		}
-
-		/**
-		 * Obtains the height of the subtree rooted by the given node.
-		 *
-		 * @param node the node representing the root node of the tree to be evaluated
-		 */
-		unsigned evalHeight(const NodePtr& node) {
-			std::map<NodePtr,unsigned> cache;
-			return getHeight(node,cache);
-		}
-
 		/**
 		 * A helper class for counting the number of addressable nodes.
 		 */
 		struct AddressableNodesStatistic {
-			std::uint64_t numAddressableNodes;
 			std::uint64_t nodeTypeInfo[NUM_CONCRETE_NODE_TYPES];
 
-			AddressableNodesStatistic() : numAddressableNodes(0) {
+			AddressableNodesStatistic() {
 				for(int i=0; i<NUM_CONCRETE_NODE_TYPES; i++) {
 					nodeTypeInfo[i] = 0;
 				}
 			}
 
 			AddressableNodesStatistic& operator+=(const AddressableNodesStatistic& other) {
-				numAddressableNodes += other.numAddressableNodes;
 				for(int i=0; i<NUM_CONCRETE_NODE_TYPES; i++) {
 					nodeTypeInfo[i] += other.nodeTypeInfo[i];
 				}
@@ -115,7 +85,6 @@ namespace core {
 			}
 
 			// count this node
-			res.numAddressableNodes++;
 			res.nodeTypeInfo[node->getNodeType()]++;
 
 			// cache and return result
@@ -145,15 +114,15 @@ namespace core {
 			res.nodeTypeInfo[ptr->getNodeType()].numShared++;
 		}, true));
 
-		// ... and addressable nodes
+		// ... and addressable nodes (the total is maintained by the node itself)
 		auto stat = countAddressableNodes(node);
-		res.numAddressableNodes = stat.numAddressableNodes;
+		res.numAddressableNodes = node->getTreeSize();
 		for(int i=0; i<NUM_CONCRETE_NODE_TYPES; i++) {
 			res.nodeTypeInfo[i].numAddressable = stat.nodeTypeInfo[i];
 		}
 
-		// ... and height (lightweight)
-		res.height = evalHeight(node);
+		// ... and height (computed when constructing the node)
+		res.height = node->getTreeDepth();
 
 		// build result
 		return res;
@@ -163,23 +132,36 @@ namespace core {
 		memset(nodeTypeInfo, 0, sizeof(NodeTypeInfo) * NUM_CONCRETE_NODE_TYPES);
 	};
 
-	NodeStatistic NodeStatistic::evaluate(const NodeManager& manager) {
-		NodeStatistic res;
+	namespace {
 
-		// collect memory requirement
-		unsigned perNodeMemory[NUM_CONCRETE_NODE_TYPES];
+		/**
+		 * Obtains the amount of memory consumed by the given node, not including annotations.
+		 */
+		unsigned getNodeMemory(const NodePtr& ptr) {
+			// collect memory requirement
+			static const struct PerNodeMemory {
+				unsigned size[NUM_CONCRETE_NODE_TYPES];
+				PerNodeMemory() {
+					#define CONCRETE(name)                                                                                                                     \
+						size[NT_##name] = sizeof(name);
+
+					// the necessary information is obtained from the node-definition file
+					#include "insieme/core/ir_nodes.def"
+					#undef CONCRETE
+				}
+			} perNodeMemory;
 
-		#define CONCRETE(name)                                                                                                                                 \
-			perNodeMemory[NT_##name] = sizeof(name);                                                                                                           \
-		// std::cout << "Nodes of type " #name " require " << sizeof(name) << " bytes.\n";
+			return perNodeMemory.size[ptr->getNodeType()] + sizeof(NodePtr) * ptr->getChildList().size();
+		}
 
-		// the necessary information is obtained from the node-definition file
-		#include "insieme/core/ir_nodes.def"
-		#undef CONCRETE
+	}
+
+	NodeStatistic NodeStatistic::evaluate(const NodeManager& manager) {
+		NodeStatistic res;
 
 		for_each(manager, [&](const NodePtr& ptr) {
 
-			unsigned curMem = perNodeMemory[ptr->getNodeType()] + sizeof(NodePtr) * ptr->getChildList().size();
+			unsigned curMem = getNodeMemory(ptr);
 
 			res.numNodes++;
 			res.totalMemory += curMem;
@@ -191,6 +173,46 @@ namespace core {
 	}
 
 
+	LivenessStatistic::LivenessStatistic() : numLiveNodes(0), numDeadNodes(0), liveMemory(0), deadMemory(0) {
+		memset(nodeTypeInfo, 0, sizeof(NodeTypeInfo) * NUM_CONCRETE_NODE_TYPES);
+	};
+
+	LivenessStatistic LivenessStatistic::evaluate(const NodeManager& manager, const vector<NodePtr>& roots) {
+		LivenessStatistic res;
+
+		// mark all nodes reachable from the roots
+		std::unordered_set<const Node*> live;
+		vector<const Node*> stack;
+		for(const auto& cur : roots) {
+			if(cur) { stack.push_back(&*cur); }
+		}
+		while(!stack.empty()) {
+			const Node* cur = stack.back();
+			stack.pop_back();
+			if(!live.insert(cur).second) { continue; }
+			for(const auto& child : cur->getChildNodeList()) {
+				stack.push_back(&*child);
+			}
+		}
+
+		// classify the nodes of the manager
+		for_each(manager, [&](const NodePtr& ptr) {
+			unsigned curMem = getNodeMemory(ptr);
+			if(live.find(&*ptr) != live.end()) {
+				res.numLiveNodes++;
+				res.liveMemory += curMem;
+				res.nodeTypeInfo[ptr->getNodeType()].numLive++;
+			} else {
+				res.numDeadNodes++;
+				res.deadMemory += curMem;
+				res.nodeTypeInfo[ptr->getNodeType()].numDead++;
+			}
+		});
+
+		return res;
+	}
+
+
 } // end namespace core
 } // end namespace insieme
 
@@ -301,4 +323,42 @@ namespace std {
 		    << std::endl;
 		return out;
 	}
+
+	std::ostream& operator<<(std::ostream& out, const insieme::core::LivenessStatistic& statistics) {
+		// extract node info records
+		vector<NodeInfo> infos;
+
+		unsigned numLive;
+		unsigned numDead;
+
+		#define CONCRETE(name)                                                                                                                                 \
+			numLive = statistics.getNodeTypeInfo(insieme::core::NT_##name).numLive;                                                                            \
+			numDead = statistics.getNodeTypeInfo(insieme::core::NT_##name).numDead;                                                                            \
+			if(numLive + numDead > 0) infos.push_back(NodeInfo(" " #name, numLive + numDead, numDead));
+
+		// the necessary information is obtained from the node-definition file
+		#include "insieme/core/ir_nodes.def"
+		#undef CONCRETE
+
+		// sort records
+		sort(infos.begin(), infos.end());
+
+
+		// print data
+		out << "                           --- Node Liveness ---" << std::endl;
+
+		// print data
+		out << format("%30s%10s%10s%10s%10s", "NodeType", "Total", "Live", "Dead", "Dead %") << std::endl;
+		out << "        --------------------------------------------------------------------" << std::endl;
+		std::for_each(infos.rbegin(), infos.rend(), [&out](const NodeInfo& cur) {
+			out << format("%30s%10d%10d%10d%9.1f%%", cur.name, cur.num, cur.num - cur.used, cur.used, cur.ratio * 100) << std::endl;
+		});
+		out << "        --------------------------------------------------------------------" << std::endl;
+		unsigned total = statistics.getNumLiveNodes() + statistics.getNumDeadNodes();
+		out << format("%30s%10d%10d%10d%9.1f%%", "Total", total, statistics.getNumLiveNodes(), statistics.getNumDeadNodes(),
+		              (total == 0) ? 0.0 : statistics.getNumDeadNodes() * 100 / (double)total)
+		    << std::endl;
+		out << format("%30s%10s%10d%10d", "Memory", "", statistics.getLiveMemory(), statistics.getDeadMemory()) << std::endl;
+		return out;
+	}
 }
@@ -43,6 +43,7 @@
 #include "insieme/core/analysis/ir_utils.h"
 #include "insieme/core/analysis/normalize.h"
 #include "insieme/core/lang/lang.h"
+#include "insieme/core/lang/extension_snapshot.h"
 
 #include "insieme/utils/set_utils.h"
 #include "insieme/utils/map_utils.h"
@@ -210,7 +211,7 @@ namespace lang {
 	#define TYPE(_id, _spec)                                                                                                                                   \
 		TypePtr BasicGenerator::get##_id() const {                                                                                                             \
 			if(!pimpl->ptr##_id) {                                                                                                                             \
-				pimpl->ptr##_id = parser::parseType(nm, _spec, false);                                                                                         \
+				pimpl->ptr##_id = lang::ExtensionSnapshot::getDefault().getType(nm, _spec);                                                                    \
 				markAsBuiltIn(pimpl->ptr##_id);                                                                                                                \
 			}                                                                                                                                                  \
 			return pimpl->ptr##_id;                                                                                                                            \
@@ -222,7 +223,7 @@ namespace lang {
 	#define LITERAL(_id, _name, _spec)                                                                                                                         \
 		LiteralPtr BasicGenerator::get##_id() const {                                                                                                          \
 			if(!pimpl->ptr##_id) {                                                                                                                             \
-				pimpl->ptr##_id = pimpl->build.literal(parser::parseType(nm, _spec, false), _name);                                                            \
+				pimpl->ptr##_id = pimpl->build.literal(lang::ExtensionSnapshot::getDefault().getType(nm, _spec), _name);                                       \
 				markAsBuiltIn(pimpl->ptr##_id);                                                                                                                \
 			}                                                                                                                                                  \
 			return pimpl->ptr##_id;                                                                                                                            \
@@ -237,7 +238,7 @@ namespace lang {
 	#define DERIVED(_id, _name, _spec)                                                                                                                         \
 		ExpressionPtr BasicGenerator::get##_id() const {                                                                                                       \
 			if(!pimpl->ptr##_id) {                                                                                                                             \
-				pimpl->ptr##_id = analysis::normalize(parser::parseExpr(nm, _spec, false));                                                                    \
+				pimpl->ptr##_id = lang::ExtensionSnapshot::getDefault().getExpression(nm, _spec);                                                              \
 				if(pimpl->ptr##_id.isa<insieme::core::LambdaExprPtr>()) {                                                                                      \
 					pimpl->ptr##_id = insieme::core::LambdaExpr::get(nm, pimpl->ptr##_id.as<insieme::core::LambdaExprPtr>()->getLambda(), _name);              \
 				}                                                                                                                                              \
@@ -257,7 +258,7 @@ namespace lang {
 	#define OPERATION(_type, _op, _name, _spec)                                                                                                                \
 		LiteralPtr BasicGenerator::get##_type##_op() const {                                                                                                   \
 			if(!pimpl->ptr##_type##_op) {                                                                                                                      \
-				pimpl->ptr##_type##_op = pimpl->build.literal(parser::parseType(nm, _spec, false), _name);                                                     \
+				pimpl->ptr##_type##_op = pimpl->build.literal(lang::ExtensionSnapshot::getDefault().getType(nm, _spec), _name);                                \
 				markAsBuiltIn(pimpl->ptr##_type##_op);                                                                                                         \
 			}                                                                                                                                                  \
 			return pimpl->ptr##_type##_op;                                                                                                                     \
@@ -269,7 +270,7 @@ namespace lang {
 	#define DERIVED_OP(_type, _op, _name, _spec)                                                                                                               \
 		ExpressionPtr BasicGenerator::get##_type##_op() const {                                                                                                \
 			if(!pimpl->ptr##_type##_op) {                                                                                                                      \
-				pimpl->ptr##_type##_op = analysis::normalize(parser::parseExpr(nm, _spec, false));                                                             \
+				pimpl->ptr##_type##_op = lang::ExtensionSnapshot::getDefault().getExpression(nm, _spec);                                                       \
 				if(pimpl->ptr##_type##_op.isa<insieme::core::LambdaExprPtr>()) {                                                                               \
 					pimpl->ptr##_type##_op = insieme::core::LambdaExpr::get(nm, pimpl->ptr##_type##_op.as<insieme::core::LambdaExprPtr>()->getLambda(), _name);\
 				}                                                                                                                                              \
@@ -317,6 +318,10 @@ namespace lang {
 		return getLiteral(name);
 	}
 
+	bool BasicGenerator::hasBuiltIn(const string& name) const {
+		return pimpl->derivedMap.find(name) != pimpl->derivedMap.end() || pimpl->literalMap.find(name) != pimpl->literalMap.end();
+	}
+
 
 	bool BasicGenerator::isType(const NodePtr& type) const {
 		return type->getNodeCategory() == NC_Type && analysis::isTypeLiteralType(type.as<TypePtr>());
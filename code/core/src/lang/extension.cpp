@@ -36,6 +36,7 @@
  */
 
 #include "insieme/core/lang/extension.h"
+#include "insieme/core/lang/extension_snapshot.h"
 
 #include "insieme/core/parser/ir_parser.h"
 #include "insieme/core/ir_expressions.h"
@@ -64,7 +65,7 @@ namespace lang {
 
 	TypePtr Extension::getType(NodeManager& manager, const string& type, const symbol_map& definitions, const type_alias_map& aliases) {
 		// build type
-		TypePtr res = parser::parseType(manager, type, false, definitions, aliases);
+		TypePtr res = ExtensionSnapshot::getDefault().getType(manager, type, definitions, aliases);
 		assert_true(res) << "Unable to parse type: " << type;
 		return res;
 	}
@@ -74,8 +75,7 @@ namespace lang {
 	}
 
 	ExpressionPtr Extension::getExpression(NodeManager& manager, const string& spec, const symbol_map& definitions, const type_alias_map& aliases) {
-		insieme::core::IRBuilder builder(manager);
-		return builder.normalize(parser::parseExpr(manager, spec, false, definitions, aliases));
+		return ExtensionSnapshot::getDefault().getExpression(manager, spec, definitions, aliases);
 	}
 
 } // end namespace lang
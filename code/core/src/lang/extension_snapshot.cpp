@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include "insieme/core/lang/extension_snapshot.h"
+
+#include <cstdlib>
+#include <fstream>
+
+#include <boost/functional/hash.hpp>
+
+#include "insieme/core/ir_builder.h"
+#include "insieme/core/parser/ir_parser.h"
+#include "insieme/core/dump/binary_dump.h"
+#include "insieme/core/dump/binary_utils.h"
+
+#include "insieme/utils/logging.h"
+
+namespace insieme {
+namespace core {
+namespace lang {
+
+	namespace {
+
+		/**
+		 * A magic number marking the begin of a snapshot stream.
+		 */
+		const uint64_t SNAPSHOT_MAGIC_NUMBER = 0x494e53534e4150; // HEX version of INSSNAP
+
+		/**
+		 * Builds the key identifying a construct within the snapshot. Symbols are identified by their
+		 * names only, to avoid the resolution of the lazy symbol factories.
+		 */
+		string getKey(char kind, const string& spec, const symbol_map& definitions, const type_alias_map& aliases) {
+			std::size_t seed = 0;
+			for(const auto& cur : definitions) {
+				boost::hash_combine(seed, cur.first);
+			}
+			for(const auto& cur : aliases) {
+				boost::hash_combine(seed, (*cur.first).hash());
+				boost::hash_combine(seed, (*cur.second).hash());
+			}
+			return string(1, kind) + ":" + std::to_string(seed) + ":" + spec;
+		}
+
+		string loadString(std::istream& in) {
+			auto length = dump::binary::utils::read<dump::binary::utils::length_t>(in);
+			string res(length, '\0');
+			in.read(&res[0], length);
+			return res;
+		}
+
+	}
+
+	ExtensionSnapshot& ExtensionSnapshot::getDefault() {
+		static ExtensionSnapshot snapshot;
+		static bool initialized = [&]() {
+			if(auto file = getenv(INSIEME_LANG_SNAPSHOT)) {
+				std::ifstream in(file, std::ios::binary);
+				if(!in || !snapshot.load(in)) { LOG(WARNING) << "Unable to load language extension snapshot " << file; }
+			}
+			return true;
+		}();
+		assert_true(initialized);
+		return snapshot;
+	}
+
+	TypePtr ExtensionSnapshot::getType(NodeManager& manager, const string& spec, const symbol_map& definitions, const type_alias_map& aliases) {
+		return get(manager, getKey('T', spec, definitions, aliases), [&]() -> NodePtr {
+			return parser::parseType(manager, spec, false, definitions, aliases);
+		}).as<TypePtr>();
+	}
+
+	ExpressionPtr ExtensionSnapshot::getExpression(NodeManager& manager, const string& spec, const symbol_map& definitions, const type_alias_map& aliases) {
+		return get(manager, getKey('E', spec, definitions, aliases), [&]() -> NodePtr {
+			return IRBuilder(manager).normalize(parser::parseExpr(manager, spec, false, definitions, aliases));
+		}).as<ExpressionPtr>();
+	}
+
+	NodePtr ExtensionSnapshot::get(NodeManager& manager, const string& key, const std::function<NodePtr()>& parse) {
+		NodePtr recorded;
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			auto pos = entries.find(key);
+			if(pos != entries.end()) {
+				recorded = pos->second;
+				hits++;
+			} else {
+				misses++;
+			}
+		}
+
+		// copy a recorded construct into the requesting manager
+		if(recorded) { return manager.get(recorded); }
+
+		// parse the construct - outside the lock since it may request further constructs
+		NodePtr res = parse();
+		if(!res) { return res; }
+
+		// record the result
+		NodePtr copy = this->manager.get(res);
+		std::lock_guard<std::mutex> guard(lock);
+		entries.insert({key, copy});
+		return res;
+	}
+
+	std::size_t ExtensionSnapshot::size() const {
+		std::lock_guard<std::mutex> guard(lock);
+		return entries.size();
+	}
+
+	unsigned ExtensionSnapshot::getNumHits() const {
+		std::lock_guard<std::mutex> guard(lock);
+		return hits;
+	}
+
+	unsigned ExtensionSnapshot::getNumMisses() const {
+		std::lock_guard<std::mutex> guard(lock);
+		return misses;
+	}
+
+	void ExtensionSnapshot::store(std::ostream& out) const {
+		std::lock_guard<std::mutex> guard(lock);
+		dump::binary::utils::write(out, SNAPSHOT_MAGIC_NUMBER);
+		dump::binary::utils::write<uint32_t>(out, entries.size());
+		for(const auto& cur : entries) {
+			dump::binary::utils::dumpString(out, cur.first);
+			dump::binary::dumpIR(out, cur.second);
+		}
+	}
+
+	bool ExtensionSnapshot::load(std::istream& in) {
+		if(dump::binary::utils::read<uint64_t>(in) != SNAPSHOT_MAGIC_NUMBER) { return false; }
+
+		// load all entries before registering any of them
+		std::map<string, NodePtr> loaded;
+		try {
+			auto count = dump::binary::utils::read<uint32_t>(in);
+			for(uint32_t i = 0; i < count && in; i++) {
+				auto key = loadString(in);
+				loaded[key] = dump::binary::loadIR(in, manager);
+			}
+		} catch(const dump::InvalidEncodingException& e) {
+			LOG(WARNING) << "Invalid language extension snapshot: " << e.what();
+			return false;
+		}
+		if(!in) { return false; }
+
+		std::lock_guard<std::mutex> guard(lock);
+		entries.insert(loaded.begin(), loaded.end());
+		return true;
+	}
+
+} // end namespace lang
+} // end namespace core
+} // end namespace insieme
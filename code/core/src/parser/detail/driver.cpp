@@ -102,6 +102,7 @@ namespace parser {
 				#define DERIVED(_id, _name, _code) LITERAL(_id, _name, fail) mgr.getLangBasic().get##_id();
 				#define OPERATION(_type, _op, _name, _spec)                  mgr.getLangBasic().get##_type##_op();
 				#define DERIVED_OP(_type, _op, _name, _spec)                 mgr.getLangBasic().get##_type##_op();
+				#define GROUP(_id, ...)                                      mgr.getLangBasic().get##_id##Group();
 
 				#include "insieme/core/lang/inspire_api/lang.def"
 			}
@@ -902,7 +903,8 @@ namespace parser {
 		}
 
 		ParserTypedExpression InspireDriver::genTypedExpression(const location& l, const ExpressionPtr& expression, const TypePtr& type) {
-			if (!types::getTypeVariableInstantiation(mgr, type, expression->getType())) {
+			// the explicitly given type usually is the type of the expression, which does not need to be checked
+			if (type != expression->getType() && !types::getTypeVariableInstantiation(mgr, type, expression->getType())) {
 				error(l, format("The given explicit expression type %s does not match the expression of type %s", *type, *expression->getType()));
 				return {};
 			}
@@ -1493,7 +1495,7 @@ namespace parser {
 		NodePtr InspireDriver::lookupDeclared(const std::string& name) {
 			// look in declared symbols
 			for(auto it = scopes.rbegin(); it != scopes.rend(); ++it) {
-				const DefinitionMap& cur = (*it)->declaredSymbols;
+				const SymbolTable& cur = (*it)->declaredSymbols;
 				auto pos = cur.find(name);
 				if(pos != cur.end()) { return pos->second(); }
 			}
@@ -1501,7 +1503,7 @@ namespace parser {
 		}
 
 		NodePtr InspireDriver::lookupDeclaredInGlobalScope(const std::string& name) {
-			const DefinitionMap& cur = scopes[0]->declaredSymbols;
+			const SymbolTable& cur = scopes[0]->declaredSymbols;
 			auto pos = cur.find(name);
 			if(pos != cur.end()) { return pos->second(); }
 			return nullptr;
@@ -1513,7 +1515,7 @@ namespace parser {
 			NodePtr result = lookupDeclared(name);
 
 			// look in lang basic
-			if(!result) {
+			if(!result && builder.getLangBasic().hasBuiltIn(name)) {
 				try {
 					result = builder.getLangBasic().getBuiltIn(name);
 				} catch(...) {
@@ -1550,7 +1552,7 @@ namespace parser {
 
 			// look in declared types
 			for(auto it = scopes.rbegin(); it != scopes.rend(); ++it) {
-				const DefinitionMap& cur = (*it)->declaredTypes;
+				const SymbolTable& cur = (*it)->declaredTypes;
 				auto pos = cur.find(name);
 				if(pos != cur.end()) {
 					result = pos->second();
@@ -1657,9 +1659,13 @@ namespace parser {
 
 		void InspireDriver::addTypeAlias(const TypePtr& pattern, const TypePtr& substitute) {
 			if(*pattern == *substitute) return;
-			auto& aliases = getCurrentScope()->aliases;
-			assert_true(aliases.find(pattern) == aliases.end());
-			aliases[pattern] = substitute;
+			auto& scope = *getCurrentScope();
+			assert_true(scope.aliases.find(pattern) == scope.aliases.end());
+			scope.aliases[pattern] = substitute;
+
+			// index the alias by the family name of the pattern
+			auto genPattern = pattern.isa<GenericTypePtr>();
+			scope.aliasIndex[genPattern ? genPattern->getFamilyName() : ""][pattern] = substitute;
 		}
 
 		TypePtr InspireDriver::resolveTypeAliases(const location& l, const TypePtr& type) {
@@ -1667,9 +1673,9 @@ namespace parser {
 
 			NodeManager& mgr = type.getNodeManager();
 
-			// run through alias lists
-			for(auto it = scopes.rbegin(); it != scopes.rend(); ++it) {
-				for(const auto& cur : (*it)->aliases) {
+			// obtains the result of the first alias of the given list matching the type
+			auto applyAlias = [&](const std::map<TypePtr, TypePtr>& aliases) -> TypePtr {
+				for(const auto& cur : aliases) {
 					// check whether pattern matches
 					if(auto sub = types::match(mgr, type, cur.first)) {
 						// compute substitution
@@ -1680,11 +1686,23 @@ namespace parser {
 							                  << "Substitute: " << *cur.first << "\n"
 							                  << "Match:      " << *sub << "\n"
 							                  << "Next:       " << *next << "\n";
-
-						// apply pattern and start over again
-						return resolveTypeAliases(l, next);
+						return next;
 					}
 				}
+				return nullptr;
+			};
+
+			// run through alias lists - only aliases of the same family or with non-generic patterns may match
+			auto genType = type.isa<GenericTypePtr>();
+			for(auto it = scopes.rbegin(); it != scopes.rend(); ++it) {
+				const auto& index = (*it)->aliasIndex;
+				auto family = (genType) ? index.find(genType->getFamilyName()) : index.end();
+				for(auto bucket : { family, index.find("") }) {
+					if(bucket == index.end()) { continue; }
+
+					// apply pattern and start over again
+					if(auto next = applyAlias(bucket->second)) { return resolveTypeAliases(l, next); }
+				}
 			}
 
 			// no matching alias fond => done
@@ -591,6 +591,111 @@ namespace insieme {
 			return out << *pattern;
 		}
 
+		namespace {
+
+			RootFilter getRootFilter(const impl::TreePattern& pattern) {
+				RootFilter res;
+				res.mayBeType = pattern.mayBeType;
+				switch(pattern.type) {
+				case impl::TreePattern::Constant: {
+					const auto& constant = static_cast<const impl::tree::Constant&>(pattern);
+					if(constant.nodeAtom) {
+						res.anyType = false;
+						res.types.insert(constant.nodeAtom->getNodeType());
+						res.atoms.push_back(constant.nodeAtom);
+					}
+					return res;
+				}
+				case impl::TreePattern::Node: {
+					const auto& node = static_cast<const impl::tree::Node&>(pattern);
+					if(node.type != -1) {
+						res.anyType = false;
+						res.types.insert((core::NodeType)node.type);
+					}
+					return res;
+				}
+				case impl::TreePattern::Variable: {
+					res = getRootFilter(*static_cast<const impl::tree::Variable&>(pattern).pattern);
+					res.mayBeType = res.mayBeType && pattern.mayBeType;
+					return res;
+				}
+				case impl::TreePattern::Recursion: {
+					const auto& rec = static_cast<const impl::tree::Recursion&>(pattern);
+					if(!rec.terminal) { res = getRootFilter(*rec.pattern); }
+					res.mayBeType = res.mayBeType && pattern.mayBeType;
+					return res;
+				}
+				case impl::TreePattern::Conjunction: {
+					// a node has to pass both filters
+					const auto& conjunction = static_cast<const impl::tree::Conjunction&>(pattern);
+					auto a = getRootFilter(*conjunction.pattern1);
+					auto b = getRootFilter(*conjunction.pattern2);
+					if(a.anyType) {
+						res.anyType = b.anyType;
+						res.types = b.types;
+					} else if(b.anyType) {
+						res.types = a.types;
+						res.anyType = false;
+					} else {
+						res.anyType = false;
+						std::set_intersection(a.types.begin(), a.types.end(), b.types.begin(), b.types.end(), std::inserter(res.types, res.types.end()));
+					}
+					res.atoms = (a.atoms.empty()) ? b.atoms : a.atoms;
+					res.mayBeType = a.mayBeType && b.mayBeType;
+					return res;
+				}
+				case impl::TreePattern::Disjunction: {
+					// a node has to pass one of the filters
+					const auto& disjunction = static_cast<const impl::tree::Disjunction&>(pattern);
+					auto a = getRootFilter(*disjunction.pattern1);
+					auto b = getRootFilter(*disjunction.pattern2);
+					res.anyType = a.anyType || b.anyType;
+					if(!res.anyType) {
+						res.types = a.types;
+						res.types.insert(b.types.begin(), b.types.end());
+					}
+					if(!a.atoms.empty() && !b.atoms.empty()) {
+						res.atoms = a.atoms;
+						res.atoms.insert(res.atoms.end(), b.atoms.begin(), b.atoms.end());
+					}
+					res.mayBeType = a.mayBeType || b.mayBeType;
+					return res;
+				}
+				// all others may match any kind of node
+				case impl::TreePattern::Value:
+				case impl::TreePattern::LazyConstant:
+				case impl::TreePattern::Wildcard:
+				case impl::TreePattern::Negation:
+				case impl::TreePattern::Descendant:
+				case impl::TreePattern::Lambda: return res;
+				}
+				assert_fail() << "Missed a pattern type!";
+				return res;
+			}
+		}
+
+		RootFilter TreePattern::getRootFilter() const {
+			return pattern::getRootFilter(*pattern);
+		}
+
+		bool RootFilter::covers(const core::NodePtr& node) const {
+			auto type = node->getNodeType();
+			if(!mayBeType && details::isTypeOrValueOrParam(type)) { return false; }
+			if(!anyType && !types.count(type)) { return false; }
+			return atoms.empty() || ::any(atoms, [&](const core::NodePtr& atom) { return *atom == *node; });
+		}
+
+		std::ostream& RootFilter::printTo(std::ostream& out) const {
+			if(anyType) {
+				out << "*";
+			} else {
+				out << "{" << join(",", types) << "}";
+			}
+			if(!atoms.empty()) { out << "[" << atoms.size() << " atoms]"; }
+			if(!mayBeType) { out << "[no types]"; }
+			return out;
+		}
+
 		ListPattern::ListPattern() : pattern(anyList.pattern) {}
 
 		TreeMatchOpt ListPattern::match(const vector<TreePtr>& trees) const {
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include "insieme/core/pattern/rule_set.h"
+
+#include "insieme/core/transform/node_replacer.h"
+
+#include "insieme/utils/container_utils.h"
+
+namespace insieme {
+namespace core {
+namespace pattern {
+
+	RuleSet::RuleSet(const std::vector<Rule>& rules) : rules(rules), candidates(NUM_CONCRETE_NODE_TYPES), attempts(0), skipped(0) {
+		// index rules by the types of nodes their patterns may match
+		for(unsigned i = 0; i < rules.size(); i++) {
+			filters.push_back(rules[i].getPattern().getRootFilter());
+			const auto& filter = filters.back();
+			for(unsigned type = 0; type < NUM_CONCRETE_NODE_TYPES; type++) {
+				if(filter.anyType || filter.types.count((NodeType)type)) { candidates[type].push_back(i); }
+			}
+		}
+	}
+
+	RuleSet::RuleSet(const RuleSet& other)
+	    : rules(other.rules), filters(other.filters), candidates(other.candidates), attempts(0), skipped(0) {}
+
+	RuleSet& RuleSet::operator=(const RuleSet& other) {
+		rules = other.rules;
+		filters = other.filters;
+		candidates = other.candidates;
+		attempts = 0;
+		skipped = 0;
+		return *this;
+	}
+
+	core::NodePtr RuleSet::applyTo(const core::NodePtr& node) const {
+		const auto& list = candidates[node->getNodeType()];
+		skipped += rules.size() - list.size();
+		for(unsigned i : list) {
+			// check the remaining properties of the filter before running the matcher
+			if(!filters[i].covers(node)) {
+				skipped++;
+				continue;
+			}
+			attempts++;
+			if(auto res = rules[i].applyTo(node)) { return res; }
+		}
+		return core::NodePtr();
+	}
+
+	core::NodePtr RuleSet::find(const core::NodePtr& node, MatchFailureMemo& memo, core::NodePtr& match) const {
+		// skip sub-DAGs known to be free of applicable nodes
+		if(memo.failedSubDAGs.count(node.ptr)) { return core::NodePtr(); }
+
+		// try the current node
+		if(!memo.failedNodes.count(node.ptr)) {
+			if(auto res = applyTo(node)) {
+				match = node;
+				return res;
+			}
+			memo.failedNodes.insert(node.ptr);
+		}
+
+		// search the child nodes
+		for(const auto& child : node->getChildList()) {
+			if(auto res = find(child, memo, match)) { return res; }
+		}
+
+		// no applicable node within this sub-DAG
+		memo.failedSubDAGs.insert(node.ptr);
+		return core::NodePtr();
+	}
+
+	core::NodePtr RuleSet::applyToNested(const core::NodePtr& node, MatchFailureMemo& memo) const {
+		core::NodePtr match;
+		auto res = find(node, memo, match);
+		if(!res) { return res; }
+		if(match == node) { return res; }
+		return core::transform::replaceAll(node->getNodeManager(), node, match, res);
+	}
+
+	core::NodePtr RuleSet::fixpoint(const core::NodePtr& node) const {
+		auto res = node;
+		while(auto next = applyTo(res)) {
+			if(res == next) { return res; }
+			res = next;
+		}
+		return res;
+	}
+
+	core::NodePtr RuleSet::fixpointNested(const core::NodePtr& node) const {
+		MatchFailureMemo memo;
+		auto res = node;
+		while(auto next = applyToNested(res, memo)) {
+			if(res == next) { return res; }
+			res = next;
+		}
+		return res;
+	}
+
+	std::ostream& RuleSet::printTo(std::ostream& out) const {
+		out << "RuleSet(";
+		for(unsigned i = 0; i < rules.size(); i++) {
+			out << "\n\t" << filters[i] << " : " << rules[i];
+		}
+		return out << ")";
+	}
+
+} // end namespace pattern
+} // end namespace core
+} // end namespace insieme
@@ -190,6 +190,11 @@ namespace printer {
 			 */
 			unsigned indent;
 
+			/**
+			 * The indentation of the current intention level, maintained along with the level.
+			 */
+			string indentation;
+
 			/**
 			 * The pretty print handled by this printer. It is stored since it contains
 			 * various formating options.
@@ -212,6 +217,11 @@ namespace printer {
 			 */
 			mutable bool isFirstLine=true;
 
+			/**
+			 * Whether line breaks have to be written separately to the output stream, e.g. to track source locations.
+			 */
+			bool flushLines;
+
 			/**
 			 * A Map for lambdaexpr names
 			 */
@@ -278,9 +288,11 @@ namespace printer {
 			 *
 			 * @param out the stream to be printed to
 			 * @param printer the setup of the pretty printer
+			 * @param flushLines whether line breaks have to be written separately to the stream
 			 */
-			InspirePrinter(std::ostream& out, const PrettyPrinter& printer)
-			    : IRVisitor<void, Address>(true), formatTable(initFormatTable(printer)), indent(0), printer(printer), depth(0), out(&out){};
+			InspirePrinter(std::ostream& out, const PrettyPrinter& printer, bool flushLines = false)
+			    : IRVisitor<void, Address>(true), formatTable(initFormatTable(printer)), indent(0), printer(printer), depth(0), flushLines(flushLines),
+			      out(&out){};
 
 			const PrettyPrinter& getPrettyPrint() const {
 				return printer;
@@ -1370,39 +1382,48 @@ namespace printer {
 						}
 					};
 
-					std::vector<string> argStrings;
-
-					// print arguments
-					std::size_t length = 0;
-					for(auto it = begin; it < args.end(); ++it) {
-						std::stringstream argStream;
-						argPrinter(argStream,*it);
-						argStrings.push_back(argStream.str());
-						length += argStrings.back().length();
-					}
-
-					// format arguments
-					if (!printer.hasOption(PrettyPrinter::CALL_ARG_LINE_BREAKS) || length < printer.CALL_ARG_LINE_BREAKS_THRESHOLD) {
-						(*out) << "(" << join(", ", argStrings) << ")";
+					// without line breaks the arguments can be printed directly
+					if(!printer.hasOption(PrettyPrinter::CALL_ARG_LINE_BREAKS)) {
+						(*out) << "(";
+						for(auto it = begin; it < args.end(); ++it) {
+							if(it != begin) { (*out) << ", "; }
+							argPrinter(*out, *it);
+						}
+						(*out) << ")";
 					} else {
-						// add additional intention to argument strings
-						for(auto& cur : argStrings) {
-							boost::replace_all(cur,"\n","\n" + printer.tabSep);
+						std::vector<string> argStrings;
+
+						// print arguments
+						std::size_t length = 0;
+						for(auto it = begin; it < args.end(); ++it) {
+							std::stringstream argStream;
+							argPrinter(argStream,*it);
+							argStrings.push_back(argStream.str());
+							length += argStrings.back().length();
 						}
 
-						// print arguments line by line
-						(*out) << "(";
-						increaseIndent();
-						for(const auto& cur : argStrings) {
+						// format arguments
+						if (length < printer.CALL_ARG_LINE_BREAKS_THRESHOLD) {
+							(*out) << "(" << join(", ", argStrings) << ")";
+						} else {
+							// add additional intention to argument strings
+							for(auto& cur : argStrings) {
+								boost::replace_all(cur,"\n","\n" + printer.tabSep);
+							}
+
+							// print arguments line by line
+							(*out) << "(";
+							increaseIndent();
+							for(const auto& cur : argStrings) {
+								newLine();
+								(*out) << cur;
+								if(&cur != &argStrings.back()) (*out) << ",";
+							}
+							decreaseIndent();
 							newLine();
-							(*out) << cur;
-							if(&cur != &argStrings.back()) (*out) << ",";
+							(*out) << ")";
 						}
-						decreaseIndent();
-						newLine();
-						(*out) << ")";
 					}
-
 				}
 
 				// print materialize if required
@@ -1533,15 +1554,18 @@ namespace printer {
 					return;
 				}
 				if(printer.hasOption(PrettyPrinter::PRINT_SINGLE_LINE)) { return; }
-				(*out).flush();
+
 				// print a new line
-				(*out) << std::endl;
+				if(flushLines) {
+					(*out).flush();
+					(*out) << std::endl;
+				} else {
+					(*out) << '\n';
+				}
 
 				printer.plugin.afterNewLine(*out);
 
-				for(unsigned i = 0; i < indent; i++) {
-					(*out) << printer.tabSep;
-				}
+				(*out) << indentation;
 			}
 
 			/**
@@ -1549,6 +1573,7 @@ namespace printer {
 			 */
 			void increaseIndent() {
 				indent++;
+				indentation += printer.tabSep;
 			}
 
 			/**
@@ -1556,6 +1581,7 @@ namespace printer {
 			 */
 			void decreaseIndent() {
 				indent--;
+				indentation.resize(indent * printer.tabSep.size());
 			}
 
 			/**
@@ -1641,7 +1667,7 @@ namespace printer {
 			SourceLocationMap& srcMap;
 
 			InspireMapPrinter(boost::iostreams::stream<OutputStreamWrapper>& out, SourceLocationMap& srcMap, const PrettyPrinter& printer)
-			    : InspirePrinter(out, printer), out(out), wout(*out), srcMap(srcMap) {}
+			    : InspirePrinter(out, printer, true), out(out), wout(*out), srcMap(srcMap) {}
 
 			void visit(const NodeAddress& node) {
 				out.flush();
@@ -2228,7 +2254,7 @@ namespace std {
 		insieme::core::printer::InspirePrinter(buffer, print).print(print.root);
 
 		// use buffer content if there is no color highlighting required
-		if(!print.hasOption(insieme::core::printer::PrettyPrinter::USE_COLOR)) { return out << buffer.str(); }
+		if(!print.hasOption(insieme::core::printer::PrettyPrinter::USE_COLOR)) { return out << buffer.rdbuf(); }
 
 
 		using namespace insieme::core::printer::detail;
@@ -37,6 +37,10 @@
 
 #include "insieme/core/transform/node_replacer.h"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 #include "insieme/utils/container_utils.h"
 
 #include "insieme/core/ir_builder.h"
@@ -112,6 +116,144 @@ namespace {
 		}
 	};
 
+	/**
+	 * The state shared among the replacers of a parallel replacement.
+	 */
+	struct ParallelReplacementContext {
+		NodeManager& manager;
+		const PointerMap<NodePtr, NodePtr>& replacements;
+		const ReplaceLimiter limiter;
+		const unsigned threshold;
+
+		/**
+		 * The number of threads which may still be started.
+		 */
+		std::atomic<int> freeThreads;
+
+		/**
+		 * Set if the limiter requested an interrupt.
+		 */
+		std::atomic<bool> interrupted;
+
+		/**
+		 * The lock serializing the migration of annotations, since annotations are not synchronized.
+		 */
+		std::mutex annotationLock;
+
+		ParallelReplacementContext(NodeManager& manager, const PointerMap<NodePtr, NodePtr>& replacements, const ReplaceLimiter limiter, unsigned numThreads,
+		                           unsigned threshold)
+		    : manager(manager), replacements(replacements), limiter(limiter), threshold(threshold), freeThreads(numThreads - 1), interrupted(false) {}
+	};
+
+	/**
+	 * A variant of the node replacer processing the children of large nodes concurrently
+	 * using nested instances of this replacer.
+	 */
+	class ParallelNodeReplacer : public CachedNodeMapping {
+		ParallelReplacementContext& context;
+
+		/**
+		 * The results of children processed concurrently.
+		 */
+		PointerMap<NodePtr, NodePtr> precomputed;
+
+	  public:
+		ParallelNodeReplacer(ParallelReplacementContext& context) : context(context) {}
+
+		virtual const NodePtr mapElement(unsigned index, const NodePtr& ptr) {
+			auto pos = precomputed.find(ptr);
+			if(pos != precomputed.end()) { return pos->second; }
+			return CachedNodeMapping::mapElement(index, ptr);
+		}
+
+	  private:
+		/**
+		 * Determines whether the sub-DAG rooted by the given node exceeds the size threshold.
+		 */
+		bool isLarge(const NodePtr& ptr) const {
+			// the tree size is an upper bound of the sub-DAG size and available for free
+			if(ptr->getTreeSize() < context.threshold) { return false; }
+			unsigned count = 0;
+			return visitDepthFirstOnceInterruptible(ptr, [&](const NodePtr&) { return ++count >= context.threshold; }, true, true);
+		}
+
+		/**
+		 * Processes the children of the given node concurrently, as far as threads are available.
+		 */
+		void processChildren(const NodePtr& ptr) {
+			const auto& children = ptr->getChildList();
+			std::vector<NodePtr> results(children.size());
+
+			// hand over children to new threads, keeping the first for this thread
+			std::vector<std::thread> threads;
+			std::size_t i = 1;
+			for(; i < children.size(); i++) {
+				// reserve a thread
+				if(context.freeThreads.fetch_sub(1) <= 0) {
+					context.freeThreads++;
+					break;
+				}
+				threads.emplace_back([this, &results, &children, i]() {
+					ParallelNodeReplacer nested(context);
+					results[i] = nested.map(i, children[i]);
+					context.freeThreads++;
+				});
+			}
+
+			// process the remaining children within this thread
+			mapElement(0, children[0]);
+			for(std::size_t j = i; j < children.size(); j++) {
+				mapElement(j, children[j]);
+			}
+
+			// collect the results of the other threads
+			for(std::size_t j = 0; j < threads.size(); j++) {
+				threads[j].join();
+				precomputed[children[j + 1]] = results[j + 1];
+			}
+		}
+
+		virtual const NodePtr resolveElement(const NodePtr& ptr) {
+			// we shouldn't do anything if replacement was interrupted
+			if(context.interrupted) { return ptr; }
+
+			// check which action to perform for this node
+			ReplaceAction repAction = context.limiter(ptr);
+
+			if(repAction == ReplaceAction::Interrupt) {
+				context.interrupted = true;
+				return ptr;
+			} else if(repAction == ReplaceAction::Prune) {
+				return ptr;
+			}
+
+			if(repAction != ReplaceAction::Skip) {
+				// check whether the element has been found
+				auto pos = context.replacements.find(ptr);
+				if(pos != context.replacements.end()) { return pos->second; }
+			}
+
+			// process large sub-DAGs concurrently
+			if(ptr->getChildList().size() > 1 && context.freeThreads > 0 && isLarge(ptr)) { processChildren(ptr); }
+
+			// recursive replacement has to be continued
+			NodePtr res = ptr->substitute(context.manager, *this);
+
+			// check whether something has changed ...
+			if(res == ptr) {
+				// => nothing changed
+				return ptr;
+			}
+
+			// preserve annotations
+			std::lock_guard<std::mutex> guard(context.annotationLock);
+			utils::migrateAnnotations(ptr, res);
+
+			// done
+			return res;
+		}
+	};
+
 	class TypeVariableReplacer : public CachedNodeMapping {
 		NodeManager& manager;
 		const SubstitutionOpt& substitution;
@@ -256,6 +398,22 @@ namespace transform {
 		return applyReplacer(mgr, root, replacer);
 	}
 
+	NodePtr replaceAllParallel(NodeManager& mgr, const NodePtr& root, const NodeMap& replacements, const ReplaceLimiter limiter, unsigned numThreads,
+	                           unsigned threshold) {
+		// shortcut for empty replacements
+		if(replacements.empty()) { return mgr.get(root); }
+		if(numThreads == 0) { numThreads = std::max(std::thread::hardware_concurrency(), 1u); }
+
+		// perform replacement
+		ParallelReplacementContext context(mgr, replacements, limiter, numThreads, threshold);
+		ParallelNodeReplacer replacer(context);
+		NodePtr res = applyReplacer(mgr, root, replacer);
+
+		// the result of an interrupted replacement depends on the order of the visited nodes
+		if(context.interrupted) { return replaceAll(mgr, root, replacements, limiter); }
+		return res;
+	}
+
 	NodePtr replaceVars(NodeManager& mgr, const NodePtr& root, const VariableMap& replacements) {
 		NodeMap repMap = ::transform(
 		    replacements, [](const std::pair<VariablePtr, VariablePtr>& p) { return std::make_pair(p.first.as<NodePtr>(), p.second.as<NodePtr>()); });
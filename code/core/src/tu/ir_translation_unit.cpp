@@ -37,6 +37,10 @@
 
 #include "insieme/core/tu/ir_translation_unit.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "insieme/utils/assert.h"
 #include "insieme/utils/graph_utils.h"
 #include "insieme/utils/logging.h"
@@ -74,7 +78,7 @@ namespace tu {
 			globals.push_back(Global(mgr->get(newGlobal.first), mgr->get(newGlobal.second)));
 		} else {
 			// global is already in globalsList, if the "new one" has a initValue update the init
-			if(newGlobal.second) { git->second = newGlobal.second; }
+			if(newGlobal.second) { git->second = mgr->get(newGlobal.second); }
 		}
 	}
 
@@ -165,11 +169,39 @@ namespace tu {
 		return res;
 	}
 
-	IRTranslationUnit merge(core::NodeManager& mgr, const vector<IRTranslationUnit>& units) {
+	IRTranslationUnit merge(core::NodeManager& mgr, const vector<IRTranslationUnit>& units, unsigned numThreads) {
+		// the empty unit and a single unit only need to be moved to the target manager
 		IRTranslationUnit res(mgr);
-		for(const auto& cur : units) {
-			res = merge(mgr, res, cur);
+		if(units.size() == 1) { res = units.front().toManager(mgr); }
+
+		// merge neighboring units level by level - since merging is associative and preserves
+		// the order of the units, the result is the same as merging them one after another
+		vector<IRTranslationUnit> level = units;
+		while(level.size() > 1) {
+			vector<IRTranslationUnit> next((level.size() + 1) / 2, IRTranslationUnit(mgr));
+
+			// a worker processing pairs of the current level until there are none left
+			std::atomic<unsigned> nextPair(0);
+			auto worker = [&]() {
+				for(unsigned i = nextPair++; i < next.size(); i = nextPair++) {
+					next[i] = (2 * i + 1 < level.size()) ? merge(mgr, level[2 * i], level[2 * i + 1]) : level[2 * i].toManager(mgr);
+				}
+			};
+
+			// the target manager is thread safe, thus pairs may be merged concurrently
+			vector<std::thread> threads;
+			for(unsigned i = 1; i < std::min<std::size_t>(numThreads, next.size()); ++i) {
+				threads.emplace_back(worker);
+			}
+			worker();
+			for(auto& cur : threads) {
+				cur.join();
+			}
+
+			level.swap(next);
+			if(level.size() == 1) { res = level.front(); }
 		}
+
 		res.setCXX(any(units, [](const IRTranslationUnit& cur) { return cur.isCXX(); }));
 		return res;
 	}
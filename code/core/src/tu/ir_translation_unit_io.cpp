@@ -37,9 +37,11 @@
 
 #include "insieme/core/tu/ir_translation_unit_io.h"
 
+#include <set>
 #include <tuple>
 
 #include "insieme/core/ir.h"
+#include "insieme/core/ir_visitor.h"
 
 #include "insieme/core/dump/binary_dump.h"
 
@@ -96,6 +98,145 @@ namespace tu {
 	}
 
 
+	namespace {
+
+		// the type used for encoding the eagerly restored part of a lazily loaded translation unit
+		typedef std::tuple<
+				IRTranslationUnit::GlobalsList,
+				IRTranslationUnit::Initializer,
+				IRTranslationUnit::EntryPointList,
+				bool
+			> BaseType;
+
+	}
+
+	void dumpIndexed(std::ostream& out, const IRTranslationUnit& unit) {
+		core::NodeManager localMgr(unit.getNodeManager());
+
+		// the first root is covering everything but the definitions ...
+		NodeList roots;
+		roots.push_back(core::encoder::toIR(localMgr, std::make_tuple(unit.getGlobals(), unit.getInitializer(), unit.getEntryPoints(), unit.isCXX())));
+
+		// ... followed by pairs of symbols and their definitions
+		for(const auto& cur : unit.getTypes()) {
+			roots.push_back(cur.first);
+			roots.push_back(cur.second);
+		}
+		for(const auto& cur : unit.getFunctions()) {
+			roots.push_back(cur.first);
+			roots.push_back(cur.second);
+		}
+
+		core::dump::binary::dumpIndexedIR(out, roots);
+	}
+
+	LazyIRTranslationUnit::LazyIRTranslationUnit(core::NodeManager& manager, const std::shared_ptr<dump::binary::LazyIRLoader>& loader)
+	    : loader(loader), base(manager) {
+		if(loader->getNumRoots() % 2 != 1) { throw dump::InvalidEncodingException("Encoding error: not a translation unit!"); }
+
+		// restore the base unit
+		auto values = core::encoder::toValue<BaseType>(loader->getRoot(0).as<core::ExpressionPtr>());
+		base = IRTranslationUnit(manager, IRTranslationUnit::TypeMap(), IRTranslationUnit::FunctionMap(), std::get<0>(values), std::get<1>(values),
+		                         IRTranslationUnit::EntryPointList(), std::get<3>(values));
+		entryPoints = std::get<2>(values);
+
+		// restore the symbols, but not their definitions
+		for(unsigned i = 1; i < loader->getNumRoots(); i += 2) {
+			definitions.insert({loader->getRoot(i), i + 1});
+		}
+	}
+
+	core::NodePtr LazyIRTranslationUnit::getDefinition(const core::NodePtr& symbol) const {
+		auto pos = definitions.find(symbol);
+		return (pos != definitions.end()) ? loader->getRoot(pos->second) : core::NodePtr();
+	}
+
+	IRTranslationUnit LazyIRTranslationUnit::materialize() const {
+		IRTranslationUnit res = base;
+		for(unsigned i = 1; i < loader->getNumRoots(); i += 2) {
+			auto symbol = loader->getRoot(i);
+			if(auto type = symbol.isa<GenericTypePtr>()) {
+				res.addType(type, loader->getRoot(i + 1).as<TagTypePtr>());
+			} else {
+				res.addFunction(symbol.as<LiteralPtr>(), loader->getRoot(i + 1).as<LambdaExprPtr>());
+			}
+		}
+		for(const auto& cur : entryPoints) {
+			res.addEntryPoints(cur);
+		}
+		return res;
+	}
+
+	IRTranslationUnit link(core::NodeManager& mgr, const IRTranslationUnit& unit, const vector<LazyIRTranslationUnit>& libs) {
+		// merge the eagerly restored parts of the libraries with the given unit
+		IRTranslationUnit res(mgr);
+		for(const auto& cur : libs) {
+			res = merge(mgr, res, cur.getBase());
+		}
+		res = merge(mgr, res, unit);
+
+		// restore the definitions of all symbols reachable from the merged unit
+		std::set<NodePtr> visited;
+		vector<NodePtr> pending;
+		auto collect = [&](const NodePtr& node) {
+			if(node) { pending.push_back(node); }
+		};
+		res.visitAll(collect);
+		for(const auto& lib : libs) {
+			for(const auto& cur : lib.getEntryPoints()) {
+				collect(cur);
+			}
+		}
+
+		while(!pending.empty()) {
+			NodePtr next = pending.back();
+			pending.pop_back();
+			visitDepthFirstOncePrunable(next, [&](const NodePtr& cur) -> Action {
+				if(!visited.insert(cur).second) { return Action::Prune; }
+
+				// only type and function symbols may be defined by a library
+				if(cur->getNodeType() != NT_GenericType && cur->getNodeType() != NT_Literal) { return Action::Descent; }
+
+				// the first library defining the symbol is providing the definition
+				for(const auto& lib : libs) {
+					if(!lib.isDefined(cur)) { continue; }
+					auto definition = mgr.get(lib.getDefinition(cur));
+					if(auto type = cur.isa<GenericTypePtr>()) {
+						if(res.hasType(type)) {
+							res.replaceType(type, definition.as<TagTypePtr>());
+						} else {
+							res.addType(type, definition.as<TagTypePtr>());
+						}
+					} else {
+						auto literal = cur.as<LiteralPtr>();
+						if(res[literal]) {
+							res.replaceFunction(literal, definition.as<LambdaExprPtr>());
+						} else {
+							res.addFunction(literal, definition.as<LambdaExprPtr>());
+						}
+					}
+					pending.push_back(definition);
+					break;
+				}
+				return Action::Descent;
+			}, true);
+		}
+
+		// the definitions of the entry points of the libraries are present now, which precede those of the unit
+		IRTranslationUnit::EntryPointList entryPoints;
+		for(const auto& lib : libs) {
+			for(const auto& cur : lib.getEntryPoints()) {
+				assert_true(res[cur]) << "Missing definition of entry point " << *cur;
+				entryPoints.push_back(mgr.get(cur));
+			}
+		}
+		auto& list = res.getEntryPoints();
+		list.insert(list.begin(), entryPoints.begin(), entryPoints.end());
+
+		return res;
+	}
+
+
 } // end namespace tu
 } // end namespace core
 } // end namespace insieme
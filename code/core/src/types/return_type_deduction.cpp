@@ -42,6 +42,7 @@
 #include "insieme/core/lang/basic.h"
 #include "insieme/core/types/unification.h"
 #include "insieme/core/types/type_variable_deduction.h"
+#include "insieme/core/types/type_memo.h"
 
 #include "insieme/utils/logging.h"
 
@@ -114,7 +115,10 @@ namespace types {
 		}
 	}
 
-	TypePtr tryDeduceReturnType(const FunctionTypePtr& funType, const TypeList& argumentTypes) {
+	/**
+	 * Deduces the return type of a call to a function of the given type without consulting the memo table.
+	 */
+	TypePtr computeReturnType(const FunctionTypePtr& funType, const TypeList& argumentTypes) {
 		NodeManager& manager = funType->getNodeManager();
 
 		// try deducing variable instantiations the argument types
@@ -136,6 +140,13 @@ namespace types {
 		return varInstantiation->applyTo(manager, resType);
 	}
 
+	TypePtr tryDeduceReturnType(const FunctionTypePtr& funType, const TypeList& argumentTypes) {
+		// memorize results for types of the same manager - failures are not memorized
+		NodeManager& manager = funType->getNodeManager();
+		if(!allMemorizable(manager, argumentTypes)) { return computeReturnType(funType, argumentTypes); }
+		return manager.getTypeMemo().returnTypes.get({funType, argumentTypes}, [&]() { return computeReturnType(funType, argumentTypes); });
+	}
+
 	TypePtr deduceReturnType(const FunctionTypePtr& funType, const TypeList& argumentTypes, bool unitOnFail) {
 		try {
 
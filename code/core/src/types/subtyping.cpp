@@ -44,6 +44,7 @@
 #include "insieme/core/analysis/normalize.h"
 #include "insieme/core/analysis/ir_utils.h"
 #include "insieme/core/analysis/ir++_utils.h"
+#include "insieme/core/types/type_memo.h"
 
 namespace insieme {
 namespace core {
@@ -152,7 +153,22 @@ namespace types {
 		}
 	}
 
-	bool isSubTypeOf(const TypePtr& subTy, const TypePtr& superTy) {
+	bool computeSubTypeRelation(const TypePtr& subTy, const TypePtr& superTy);
+
+	bool isSubTypeOf(const TypePtr& subType, const TypePtr& superType) {
+		// quick check - identity
+		if(subType == superType) { return true; }
+
+		// memorize results for types of the same manager
+		NodeManager& manager = subType->getNodeManager();
+		if(!isMemorizable(manager, superType)) { return computeSubTypeRelation(subType, superType); }
+		return manager.getTypeMemo().subTypes.get({subType, superType}, [&]() { return computeSubTypeRelation(subType, superType); });
+	}
+
+	/**
+	 * Determines whether the given sub-type is a sub-type of the given super type without consulting the memo table.
+	 */
+	bool computeSubTypeRelation(const TypePtr& subTy, const TypePtr& superTy) {
 		auto subType = analysis::normalize(subTy);
 		auto superType = analysis::normalize(superTy);
 
@@ -253,11 +269,27 @@ namespace types {
 		return false;
 	}
 
+	TypePtr computeJoinMeetType(const TypePtr& typeA, const TypePtr& typeB, bool join);
+
 	/**
 	 * Computes a join or meet type for the given pair of types. The join flag allows to determine
 	 * whether the join or meet type is computed.
 	 */
 	TypePtr getJoinMeetType(const TypePtr& typeA, const TypePtr& typeB, bool join) {
+		// shortcut for identical types
+		if(typeA == typeB) { return typeA; }
+
+		// memorize results for types of the same manager
+		NodeManager& manager = typeA->getNodeManager();
+		if(!isMemorizable(manager, typeB)) { return computeJoinMeetType(typeA, typeB, join); }
+		auto& table = (join) ? manager.getTypeMemo().joinTypes : manager.getTypeMemo().meetTypes;
+		return table.get({typeA, typeB}, [&]() { return computeJoinMeetType(typeA, typeB, join); });
+	}
+
+	/**
+	 * Computes a join or meet type for the given pair of types without consulting the memo tables.
+	 */
+	TypePtr computeJoinMeetType(const TypePtr& typeA, const TypePtr& typeB, bool join) {
 		static const TypePtr fail = 0;
 
 		// add a structure based algorithm for computing the Join-Type
@@ -46,6 +46,7 @@
 #include "insieme/core/transform/node_replacer.h"
 #include "insieme/core/transform/materialize.h"
 #include "insieme/core/types/subtype_constraints.h"
+#include "insieme/core/types/type_memo.h"
 #include "insieme/core/types/type_variable_renamer.h"
 
 #include "insieme/utils/annotation.h"
@@ -1107,24 +1108,6 @@ namespace types {
 
 	SubstitutionOpt getTypeVariableInstantiation(NodeManager& manager, const TypeList& parameter, const TypeList& arguments) {
 
-		using ResultMap = std::map<std::tuple<TypeList,TypeList>, SubstitutionOpt>;
-
-		struct ResultCache {
-			mutable ResultMap results;
-			bool operator==(const ResultCache& other) const {
-				assert_fail() << "Should never be reached!";
-				return false;
-			};
-		};
-
-		// initialize result cache if necessary
-		if (!manager.hasAttachedValue<ResultCache>()) {
-			manager.attachValue(ResultCache());
-		}
-
-		// obtain result cache
-		auto& cache = manager.getAttachedValue<ResultCache>().results;
-
 		// bring parameter and arguments into this node manager
 		TypeList params;
 		for (const auto& cur : parameter) params.push_back(manager.get(cur));
@@ -1132,15 +1115,8 @@ namespace types {
 		TypeList args;
 		for (const auto& cur : arguments) args.push_back(manager.get(cur));
 
-		// look up cache
-		ResultMap::key_type key { params, args };
-		auto pos = cache.find(key);
-		if (pos != cache.end()) {
-			return pos->second;
-		}
-
-		// resolve internal, cache, and return result
-		return cache[key] = getTypeVariableInstantiationInternal(manager, params, args);
+		// resolve internal using the memo table of the manager
+		return manager.getTypeMemo().instantiations.get({params, args}, [&]() { return getTypeVariableInstantiationInternal(manager, params, args); });
 	}
 
 	SubstitutionOpt getTypeVariableInstantiation(NodeManager& manager, const TypePtr& parameter, const TypePtr& argument) {
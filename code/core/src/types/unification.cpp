@@ -38,6 +38,7 @@
 #include "insieme/core/types/unification.h"
 
 #include "insieme/core/analysis/ir_utils.h"
+#include "insieme/core/types/type_memo.h"
 
 namespace insieme {
 namespace core {
@@ -310,7 +311,11 @@ namespace types {
 
 
 	boost::optional<Substitution> unify(NodeManager& manager, const TypePtr& typeA, const TypePtr& typeB) {
-		return unifyAll(manager, toVector<TypePtr>(typeA), toVector<TypePtr>(typeB));
+		auto compute = [&]() { return unifyAll(manager, toVector<TypePtr>(typeA), toVector<TypePtr>(typeB)); };
+
+		// memorize results for types of the given manager
+		if(!isMemorizable(manager, typeA, typeB)) { return compute(); }
+		return manager.getTypeMemo().unifiers.get({typeA, typeB}, compute);
 	}
 
 	boost::optional<Substitution> unifyAll(NodeManager& manager, std::list<std::pair<TypePtr, TypePtr>>& list) {
@@ -319,6 +324,9 @@ namespace types {
 
 	bool isUnifyable(const TypePtr& typeA, const TypePtr& typeB) {
 		if(typeA == typeB) { return true; }
+		// types of the same manager use its memorized unifiers
+		NodeManager& manager = typeA->getNodeManager();
+		if(isMemorizable(manager, typeB)) { return unify(manager, typeA, typeB); }
 		NodeManager tmp; // requires only temporary manager
 		return unify(tmp, typeA, typeB);
 	}
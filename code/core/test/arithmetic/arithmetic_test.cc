@@ -275,6 +275,29 @@ namespace arithmetic {
 		EXPECT_EQ("0", toString((varA - 1) + (1 - varA)));
 	}
 
+	TEST(ArithmeticTest, FormulaMultiplication) {
+		NodeManager manager;
+		IRBuilder builder(manager);
+
+		TypePtr type = builder.getLangBasic().getInt4();
+		Formula A = builder.variable(type, 1);
+		Formula B = builder.variable(type, 2);
+
+		// equal products of the cross product are summed up
+		EXPECT_EQ("v1^2-v2^2", toString((A + B) * (A - B)));
+		EXPECT_EQ("v1^2+2*v1*v2+v2^2", toString((A + B) * (A + B)));
+		EXPECT_EQ("v1^3+3*v1^2*v2+3*v1*v2^2+v2^3", toString((A + B) * (A + B) * (A + B)));
+
+		// terms cancelling out each other are dropped
+		EXPECT_EQ("0", toString((A - B) * (A + B) - (A * A - B * B)));
+		EXPECT_EQ("0", toString((A + B) * 0));
+		EXPECT_EQ("v1+v2", toString((A + B) * 1));
+
+		// the result is the same as the sum of the individual products
+		Formula f = (A + B + 1) * (A * B - Formula(2) * A + 3);
+		EXPECT_EQ(f, (A + B + 1) * (A * B) + (A + B + 1) * (Formula(-2) * A) + (A + B + 1) * 3);
+	}
+
 
 	TEST(ArithmeticTest, ProductProperties) {
 		NodeManager manager;
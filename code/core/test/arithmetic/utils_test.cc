@@ -98,6 +98,30 @@ namespace arithmetic {
 		EXPECT_EQ("v1*v2+v2-v3", toString(toFormula(tmp)));
 	}
 
+	TEST(ArithmeticUtilsTest, fromIRCached) {
+		NodeManager manager;
+		IRBuilder builder(manager);
+
+		auto a = builder.variable(builder.getLangBasic().getInt4(), 1);
+		auto b = builder.variable(builder.getLangBasic().getInt4(), 2);
+		auto formula = builder.sub(builder.mul(a, b), builder.intLit(2));
+
+		// the second conversion is answered by the result attached to the expression
+		EXPECT_EQ("v1*v2-2", toString(toFormula(formula)));
+		EXPECT_EQ("v1*v2-2", toString(toFormula(formula)));
+		EXPECT_EQ(toFormula(formula), toFormula(formula));
+
+		// also failures are reproduced
+		auto str = builder.stringLit("hello");
+		EXPECT_THROW(toFormula(str), NotAFormulaException);
+		EXPECT_THROW(toFormula(str), NotAFormulaException);
+		EXPECT_FALSE(toConstantInt(str));
+
+		// the result is not migrated to clones within other managers
+		NodeManager other;
+		EXPECT_EQ("v1*v2-2", toString(toFormula(other.get(formula))));
+	}
+
 	TEST(ArithmeticUtilsTest, extendedLiterals) {
 		NodeManager manager;
 		IRBuilder builder(manager);
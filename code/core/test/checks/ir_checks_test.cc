@@ -37,6 +37,8 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+
 #include "insieme/core/ir_builder.h"
 #include "insieme/core/checks/full_check.h"
 
@@ -149,6 +151,64 @@ namespace checks {
 		EXPECT_EQ(res[3], Message(adr4, (ErrorCode)1, "", Message::ERROR));
 	}
 
+	class CountingCheck : public IRCheck {
+	  public:
+		std::atomic<unsigned> visited;
+		CountingCheck() : IRCheck(true), visited(0) {}
+		OptionalMessageList visitNode(const NodeAddress& node) {
+			visited++;
+			auto type = node.isa<GenericTypePtr>();
+			if(!type || type->getFamilyName() != "X") { return boost::none; }
+			return MessageList(Message(node, (ErrorCode)1, "I hate X!"));
+		}
+	};
+
+	TEST(IRCheck, Memoized) {
+		NodeManager manager;
+		IRBuilder builder(manager);
+
+		GenericTypePtr typeD = builder.genericType("D");
+		GenericTypePtr typeB = builder.genericType("B", toVector<TypePtr>(typeD));
+		GenericTypePtr typeC = builder.genericType("C", toVector<TypePtr>(typeD));
+		GenericTypePtr typeA = builder.genericType("A", toVector<TypePtr>(typeB, typeC));
+
+		auto counter = std::make_shared<CountingCheck>();
+		CheckPtr memoized = makeMemoized(counter);
+
+		// the first run is checking all nodes once
+		EXPECT_TRUE(check(typeA, memoized).empty());
+		unsigned all = counter->visited;
+		EXPECT_LT(0u, all);
+
+		// the second run is skipping the whole DAG
+		counter->visited = 0;
+		EXPECT_TRUE(check(typeA, memoized).empty());
+		EXPECT_EQ(0u, counter->visited);
+
+		// a modified version is only checking the modified parts
+		counter->visited = 0;
+		GenericTypePtr typeX = builder.genericType("X", toVector<TypePtr>(typeD));
+		GenericTypePtr typeE = builder.genericType("E", toVector<TypePtr>(typeB, typeX));
+		auto res = check(typeE, memoized);
+		EXPECT_EQ(1u, res.size());
+		EXPECT_LT(0u, counter->visited);
+		EXPECT_GT(all, counter->visited);
+
+		// faulty sub-DAGs are checked again
+		counter->visited = 0;
+		EXPECT_EQ(res, check(typeE, memoized));
+		EXPECT_LT(0u, counter->visited);
+
+		// other instances are not affected by the tags
+		CheckPtr other = makeMemoized(make_check<IDontLikeAnythingCheck>());
+		EXPECT_EQ(4u, check(typeA, other).size());
+
+		// a parallel check is producing the same messages in the same order
+		CheckPtr onceCheck = makeVisitOnce(make_check<IDontLikeAnythingCheck>());
+		CheckPtr parallel = makeMemoized(make_check<IDontLikeAnythingCheck>(), 4);
+		EXPECT_EQ(check(typeE, onceCheck), check(typeE, parallel));
+	}
+
 
 	struct InspectableAnnotation : public value_annotation::has_child_list {
 		NodeList nodes;
@@ -91,6 +91,75 @@ namespace dump {
 		EXPECT_EQ(code, restored2);
 	}
 
+	TEST(BinaryDump, StoreLoadCompact) {
+		NodeManager managerA;
+		IRBuilder builder(managerA);
+
+		NodePtr code = builder.parseStmt("{ "
+		                                 "	var int<4> x = -5; "
+		                                 "	for(uint<4> i = 10u .. 50u) { "
+		                                 "		x = x + 1234567; "
+		                                 "	} "
+		                                 "}");
+
+		// dump IR using both formats
+		stringstream plain(ios_base::out | ios_base::in | ios_base::binary);
+		binary::dumpIR(plain, code);
+		stringstream compact(ios_base::out | ios_base::in | ios_base::binary);
+		binary::dumpCompactIR(compact, code);
+
+		// the compact format should be smaller
+		EXPECT_LT(compact.str().size(), plain.str().size());
+
+		// reload IR using a different node manager
+		NodeManager managerB;
+		NodePtr restored = binary::loadIR(compact, managerB);
+		EXPECT_NE(code, restored);
+		EXPECT_EQ(*code, *restored);
+
+		// reload IR using the same manager
+		compact.seekg(0);
+		EXPECT_EQ(code, binary::loadIR(compact, managerA));
+
+		// truncated encodings are rejected
+		stringstream truncated(compact.str().substr(0, compact.str().size() / 2));
+		EXPECT_THROW(binary::loadIR(truncated, managerB), InvalidEncodingException);
+	}
+
+	TEST(BinaryDump, StoreLoadIndexed) {
+		NodeManager managerA;
+		IRBuilder builder(managerA);
+
+		NodePtr a = builder.parseStmt("{ var int<4> x = 5; x + 3; }");
+		NodePtr b = builder.parseType("(int<4>, real<8>)");
+
+		// dump both fragments using the indexed format
+		stringstream buffer(ios_base::out | ios_base::in | ios_base::binary);
+		binary::dumpIndexedIR(buffer, toVector(a, b));
+		EXPECT_TRUE(binary::isIndexedIR(buffer));
+
+		// the regular loader does not accept the indexed format
+		NodeManager managerB;
+		EXPECT_THROW(binary::loadIR(buffer, managerB), InvalidEncodingException);
+
+		// restore the second fragment only
+		binary::LazyIRLoader loader(managerB, buffer.str());
+		EXPECT_EQ(2, loader.getNumRoots());
+		EXPECT_EQ(0, loader.getNumMaterializedNodes());
+
+		NodePtr restoredB = loader.getRoot(1);
+		EXPECT_EQ(*b, *restoredB);
+		EXPECT_LT(loader.getNumMaterializedNodes(), loader.getNumNodes());
+
+		// restore the first fragment as well
+		NodePtr restoredA = loader.getRoot(0);
+		EXPECT_EQ(*a, *restoredA);
+		EXPECT_EQ(restoredB, loader.getRoot(1));
+
+		// corrupted encodings are rejected
+		EXPECT_THROW(binary::LazyIRLoader(managerB, "INSPIRE"), InvalidEncodingException);
+	}
+
 	TEST(BinaryDump, StoreLoadAddress) {
 		// create a code fragment using manager A
 		NodeManager managerA;
@@ -177,6 +177,39 @@ namespace core {
 		EXPECT_EQ(ABD2.getAddressedNode(), ACD.getAddressedNode());
 	}
 
+	TEST(NodeAddressTest, Interning) {
+		NodeManager manager;
+		IRBuilder builder(manager);
+
+		TypePtr typeD = builder.genericType("D");
+		TypePtr typeB = builder.genericType("B", toVector<TypePtr>(typeD));
+		TypePtr typeC = builder.genericType("C", toVector<TypePtr>(typeD));
+		TypePtr typeA = builder.genericType("A", toVector(typeB, typeC));
+
+		// equal paths derived from the same root share their representation
+		Path root(typeA);
+		NodeAddress ABD1(root.extendForChild(2).extendForChild(0).extendForChild(2).extendForChild(0));
+		NodeAddress ABD2(root.extendForChild(2).extendForChild(0).extendForChild(2).extendForChild(0));
+		NodeAddress ACD(root.extendForChild(2).extendForChild(1).extendForChild(2).extendForChild(0));
+		EXPECT_TRUE(ABD1.getPath().isIdentical(ABD2.getPath()));
+		EXPECT_FALSE(ABD1.getPath().isIdentical(ACD.getPath()));
+		EXPECT_TRUE(ABD1.getParentAddress(2).getPath().isIdentical(ACD.getParentAddress(4).getPath().extendForChild(2).extendForChild(0)));
+
+		// paths derived from different roots are equal, yet not identical
+		NodeAddress other(Path(typeA).extendForChild(2).extendForChild(0).extendForChild(2).extendForChild(0));
+		EXPECT_EQ(ABD1, other);
+		EXPECT_FALSE(ABD1.getPath().isIdentical(other.getPath()));
+
+		// released paths are recreated on demand
+		{
+			NodeAddress tmp(root.extendForChild(0));
+			EXPECT_EQ(typeA.as<GenericTypePtr>()->getName(), tmp.getAddressedNode());
+		}
+		NodeAddress name(root.extendForChild(0));
+		EXPECT_EQ(typeA.as<GenericTypePtr>()->getName(), name.getAddressedNode());
+		EXPECT_TRUE(name.getPath().isIdentical(root.extendForChild(0)));
+	}
+
 	TEST(NodeAddressTest, LessTest) {
 		NodeManager manager;
 		IRBuilder builder(manager);
@@ -37,10 +37,14 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
+#include <thread>
+
 #include "insieme/core/ir_node.h"
 #include "insieme/core/ir_address.h"
 #include "insieme/core/ir_values.h"
 #include "insieme/core/ir_builder.h"
+#include "insieme/core/lang/reference.h"
 
 #include "insieme/utils/timer.h"
 
@@ -304,6 +308,146 @@ namespace new_core {
 		}
 	}
 
+	namespace {
+
+		NodeList buildSampleIR(NodeManager& manager, unsigned size) {
+			NodeList res;
+			TypeList types;
+			for(unsigned i = 0; i < size; ++i) {
+				auto type = GenericType::get(manager, "T" + toString(i % 17), types);
+				auto tuple = TupleType::get(manager, toVector<TypePtr>(type, GenericType::get(manager, "A")));
+				res.push_back(tuple);
+				res.push_back(Variable::get(manager, tuple, UIntValue::get(manager, i)));
+				res.push_back(Literal::get(manager, type, toString(i)));
+				if(types.size() < 5) { types.push_back(type); }
+			}
+			return res;
+		}
+
+	}
+
+	TEST(NodeManager, ArenaAllocation) {
+		NodeManager manager;
+		auto before = manager.getArena().getAllocatedBytes();
+
+		// nodes added to the manager are placed within its arena
+		GenericTypePtr type = GenericType::get(manager, "A");
+		EXPECT_LT(before, manager.getArena().getAllocatedBytes());
+
+		// also clones obtained from other managers
+		NodeManager other;
+		auto otherBefore = other.getArena().getAllocatedBytes();
+		GenericTypePtr copy = other.get(type);
+		EXPECT_EQ(*type, *copy);
+		EXPECT_NE(type, copy);
+		EXPECT_LT(otherBefore, other.getArena().getAllocatedBytes());
+	}
+
+	TEST(Node, SizeProperties) {
+		NodeManager manager;
+
+		// value nodes are leafs
+		StringValuePtr name = StringValue::get(manager, "A");
+		EXPECT_EQ(1, name->getTreeSize());
+		EXPECT_EQ(1, name->getTreeDepth());
+		EXPECT_EQ(1, name->getDAGSize());
+
+		// a generic type is composed of a name, a list of parents and a list of parameters
+		GenericTypePtr type = GenericType::get(manager, "A");
+		EXPECT_EQ(4, type->getTreeSize());
+		EXPECT_EQ(2, type->getTreeDepth());
+		EXPECT_EQ(4, type->getDAGSize());
+
+		// shared sub-structures are counted once for each occurrence in the tree, but only once within the DAG
+		TupleTypePtr tuple = TupleType::get(manager, toVector<TypePtr>(type, type));
+		EXPECT_EQ(9, tuple->getTreeSize());
+		EXPECT_EQ(3, tuple->getTreeDepth());
+		EXPECT_EQ(5, tuple->getDAGSize());
+
+		// the properties are preserved when cloning nodes to other managers
+		NodeManager other;
+		TupleTypePtr copy = other.get(tuple);
+		EXPECT_EQ(9, copy->getTreeSize());
+		EXPECT_EQ(3, copy->getTreeDepth());
+		EXPECT_EQ(5, copy->getDAGSize());
+	}
+
+	TEST(NodeManager, LookupWithoutTemporary) {
+		NodeManager base;
+		NodeManager manager(base);
+
+		// value nodes
+		StringValuePtr a = StringValue::get(base, "A");
+		EXPECT_EQ(a, StringValue::get(manager, "A"));
+		EXPECT_EQ(a, manager.getValueNode<StringValue>(string("A")));
+		EXPECT_EQ(UIntValue::get(manager, 12), manager.getValueNode<UIntValue>(12u));
+		EXPECT_NE(UIntValue::get(manager, 12), UIntValue::get(manager, 13));
+
+		// inner nodes created via child lists or individual children
+		GenericTypePtr type = GenericType::get(manager, "T");
+		auto size = manager.size();
+		EXPECT_EQ(type, GenericType::get(manager, "T"));
+		EXPECT_EQ(type, GenericType::get(manager, type->getChildList()));
+		EXPECT_EQ(type, manager.getNode<GenericType>(type->getName(), type->getParents(), type->getTypeParameter()));
+		EXPECT_EQ(size, manager.size());
+
+		// nodes sharing children but being of a different type are distinguished
+		TypeVariablePtr var = TypeVariable::get(manager, "T");
+		EXPECT_EQ(type->getName(), StringValue::get(manager, "T"));
+		EXPECT_EQ(var, manager.getNode<TypeVariable>(StringValue::get(manager, "T")));
+
+		// children maintained by other managers are located as well
+		NodeManager other;
+		EXPECT_EQ(type, manager.getNode<GenericType>(other.get(type)->getChildList()));
+	}
+
+	TEST(NodeManager, ConcurrentConstruction) {
+		NodeManager manager;
+
+		const unsigned numThreads = 8;
+		const unsigned size = 500;
+
+		std::vector<NodeList> results(numThreads);
+		std::vector<const lang::ReferenceExtension*> extensions(numThreads);
+		std::vector<std::vector<unsigned>> ids(numThreads);
+
+		std::vector<std::thread> threads;
+		for(unsigned t = 0; t < numThreads; ++t) {
+			threads.emplace_back([&, t]() {
+				extensions[t] = &manager.getLangExtension<lang::ReferenceExtension>();
+				results[t] = buildSampleIR(manager, size);
+				for(unsigned i = 0; i < size; ++i) {
+					ids[t].push_back(manager.getFreshID());
+				}
+			});
+		}
+		for(auto& cur : threads) {
+			cur.join();
+		}
+
+		// all threads have to obtain the very same nodes and extensions
+		for(unsigned t = 1; t < numThreads; ++t) {
+			EXPECT_EQ(extensions[0], extensions[t]);
+			ASSERT_EQ(results[0].size(), results[t].size());
+			for(unsigned i = 0; i < results[0].size(); ++i) {
+				EXPECT_EQ(&*results[0][i], &*results[t][i]) << "Node: " << *results[0][i];
+			}
+		}
+
+		// the nodes have to be the same as the ones created sequentially
+		auto sequential = buildSampleIR(manager, size);
+		for(unsigned i = 0; i < sequential.size(); ++i) {
+			EXPECT_EQ(&*sequential[i], &*results[0][i]);
+		}
+
+		// fresh IDs have to be unique
+		std::set<unsigned> all;
+		for(const auto& cur : ids) {
+			all.insert(cur.begin(), cur.end());
+		}
+		EXPECT_EQ(numThreads * size, all.size());
+	}
+
 } // end namespace new_core
 } // end namespace core
 } // end namespace insieme
@@ -39,6 +39,7 @@
 
 #include "insieme/core/ir_builder.h"
 #include "insieme/core/ir_statistic.h"
+#include "insieme/core/transform/manipulation_utils.h"
 
 namespace insieme {
 namespace core {
@@ -102,5 +103,44 @@ namespace core {
 		EXPECT_EQ(totalMem, stat.getTotalMemory());
 	}
 
+	TEST(IRStatistic, Liveness) {
+		NodeManager manager;
+		IRBuilder builder(manager);
+
+		// create some IR, keeping only parts of it alive
+		TypePtr typeD = builder.genericType("D");
+		TypePtr typeB = builder.genericType("B", toVector<TypePtr>(typeD));
+		TypePtr typeC = builder.genericType("C", toVector<TypePtr>(typeD));
+		TypePtr typeA = builder.genericType("A", toVector(typeB, typeC));
+		TypePtr typeE = builder.genericType("E", toVector<TypePtr>(typeB));
+
+		LivenessStatistic stat = LivenessStatistic::evaluate(manager, toVector<NodePtr>(typeA));
+
+		EXPECT_EQ(NodeStatistic::evaluate(manager).getNumNodes(), stat.getNumLiveNodes() + stat.getNumDeadNodes());
+		EXPECT_EQ(4u, stat.getNodeTypeInfo(NT_GenericType).numLive);
+		EXPECT_EQ(1u, stat.getNodeTypeInfo(NT_GenericType).numDead);
+		EXPECT_EQ(1u, stat.getNodeTypeInfo(NT_StringValue).numDead);
+		EXPECT_LT(0u, stat.getDeadMemory());
+
+		// compact the live IR into a fresh manager
+		unsigned lastID = manager.getFreshID();
+		NodeManager compacted;
+		auto roots = transform::utils::compact(toVector<NodePtr>(typeA), compacted);
+		ASSERT_EQ(1u, roots.size());
+		EXPECT_EQ(*typeA, *roots[0]);
+		EXPECT_TRUE(compacted.addressesLocal(roots[0]));
+
+		LivenessStatistic after = LivenessStatistic::evaluate(compacted, roots);
+		EXPECT_EQ(stat.getNumLiveNodes(), after.getNumLiveNodes());
+		EXPECT_EQ(0u, after.getNumDeadNodes());
+		EXPECT_EQ(stat.getLiveMemory(), after.getLiveMemory());
+		EXPECT_FALSE(compacted.contains(typeE));
+
+		// fresh IDs continue after the ones of the original manager
+		EXPECT_LT(lastID, compacted.getFreshID());
+
+		EXPECT_FALSE(toString(after).empty());
+	}
+
 } // end namespace core
 } // end namespace insieme
@@ -37,6 +37,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <mutex>
+
 #include "insieme/core/ir_program.h"
 #include "insieme/core/ir_visitor.h"
 #include "insieme/core/ir_builder.h"
@@ -338,6 +341,47 @@ TEST(IRVisitor, VisitOnceIRVisitorTest) {
 	EXPECT_TRUE(equals(toVector<NodePtr>(shared, type), res));
 }
 
+TEST(IRVisitor, VisitOnceParallelVisitorTest) {
+	NodeManager manager;
+	IRBuilder builder(manager);
+
+	// build a wide DAG sharing nodes
+	TypeList level;
+	for(int i = 0; i < 10; i++) {
+		level.push_back(builder.genericType("T" + toString(i)));
+	}
+	for(int d = 0; d < 5; d++) {
+		TypeList next;
+		for(int i = 0; i < 10; i++) {
+			next.push_back(builder.genericType("L" + toString(d) + "_" + toString(i), TypeList(level.begin() + (i % 5), level.begin() + (i % 5) + 5)));
+		}
+		level = next;
+	}
+	NodePtr root = builder.tupleType(level);
+
+	// collect the nodes sequentially
+	std::vector<NodePtr> expected;
+	visitDepthFirstOnce(root, [&](const NodePtr& cur) { expected.push_back(cur); }, true, true);
+
+	for(unsigned threads : { 1, 2, 4, 8 }) {
+		std::mutex lock;
+		std::vector<NodePtr> res;
+		visitDepthFirstOnceParallel(root, [&](const NodePtr& cur) {
+			std::lock_guard<std::mutex> guard(lock);
+			res.push_back(cur);
+		}, true, threads);
+
+		// each node is visited once, the order is unspecified
+		EXPECT_EQ(expected.size(), res.size()) << "Threads: " << threads;
+		EXPECT_EQ(NodeSet(expected.begin(), expected.end()), NodeSet(res.begin(), res.end())) << "Threads: " << threads;
+	}
+
+	// types are skipped if not requested
+	std::atomic<int> count(0);
+	visitDepthFirstOnceParallel(root, [&](const NodePtr& cur) { count++; }, false, 4);
+	EXPECT_EQ(0, count);
+}
+
 TEST(IRVisitor, UtilitiesTest) {
 	NodeManager manager;
 
@@ -66,6 +66,8 @@ TEST(LangBasic, StringGet) {
 	NodeManager nm;
 
 	EXPECT_EQ(nm.getLangBasic().getBoolEq(), nm.getLangBasic().getBuiltIn("bool_eq"));
+	EXPECT_TRUE(nm.getLangBasic().hasBuiltIn("bool_eq"));
+	EXPECT_FALSE(nm.getLangBasic().hasBuiltIn("surelyNotBuiltInISincerelyHope__"));
 }
 
 TEST(LangBasic, Grouping) {
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "insieme/core/lang/extension_snapshot.h"
+#include "insieme/core/lang/lang.h"
+#include "insieme/core/ir_builder.h"
+
+namespace insieme {
+namespace core {
+namespace lang {
+
+	TEST(ExtensionSnapshot, Reuse) {
+		ExtensionSnapshot snapshot;
+		NodeManager mgrA;
+		NodeManager mgrB;
+
+		auto a = snapshot.getType(mgrA, "(int<4>, real<8>) -> bool");
+		ASSERT_TRUE(a);
+		EXPECT_EQ(&mgrA, &a->getNodeManager());
+		EXPECT_EQ(1, snapshot.getNumMisses());
+		EXPECT_EQ(0, snapshot.getNumHits());
+
+		// the second request is served by the snapshot
+		auto b = snapshot.getType(mgrB, "(int<4>, real<8>) -> bool");
+		ASSERT_TRUE(b);
+		EXPECT_EQ(&mgrB, &b->getNodeManager());
+		EXPECT_EQ(*a, *b);
+		EXPECT_EQ(1, snapshot.getNumMisses());
+		EXPECT_EQ(1, snapshot.getNumHits());
+
+		// the result is the same as when being parsed within the target manager
+		EXPECT_EQ(b, IRBuilder(mgrB).parseType("(int<4>, real<8>) -> bool"));
+
+		// different symbols are leading to different entries
+		symbol_map symbols;
+		symbols["x"] = [&]() -> NodePtr { return IRBuilder(mgrA).parseType("int<4>"); };
+		EXPECT_EQ(IRBuilder(mgrA).parseType("int<4>"), snapshot.getType(mgrA, "x", symbols));
+		EXPECT_EQ(2, snapshot.getNumMisses());
+		EXPECT_EQ(2, snapshot.size());
+
+		// expressions are handled as well
+		auto e = snapshot.getExpression(mgrA, "(x : int<4>) -> int<4> { return x; }");
+		ASSERT_TRUE(e);
+		EXPECT_EQ(*e, *snapshot.getExpression(mgrB, "(x : int<4>) -> int<4> { return x; }"));
+		EXPECT_EQ(2, snapshot.getNumHits());
+	}
+
+	TEST(ExtensionSnapshot, StoreAndLoad) {
+		std::stringstream buffer;
+		TypePtr original;
+		{
+			ExtensionSnapshot snapshot;
+			NodeManager mgr;
+			original = snapshot.getType(mgr, "(int<4>, real<8>) -> bool");
+			ASSERT_TRUE(original);
+			snapshot.store(buffer);
+
+			// the builtin types are tagged within the source manager
+			EXPECT_TRUE(isBuiltIn(original.as<FunctionTypePtr>()->getReturnType()));
+		}
+
+		ExtensionSnapshot loaded;
+		EXPECT_TRUE(loaded.load(buffer));
+		EXPECT_EQ(1, loaded.size());
+
+		// the type can be obtained without parsing it
+		NodeManager mgr;
+		auto res = loaded.getType(mgr, "(int<4>, real<8>) -> bool");
+		ASSERT_TRUE(res);
+		EXPECT_EQ(1, loaded.getNumHits());
+		EXPECT_EQ(0, loaded.getNumMisses());
+		EXPECT_EQ(*original, *res);
+
+		// the builtin tags have been preserved
+		EXPECT_TRUE(isBuiltIn(res.as<FunctionTypePtr>()->getReturnType()));
+
+		// invalid input is rejected
+		std::stringstream invalid("no snapshot");
+		EXPECT_FALSE(loaded.load(invalid));
+	}
+
+} // end namespace lang
+} // end namespace core
+} // end namespace insieme
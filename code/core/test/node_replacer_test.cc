@@ -80,6 +80,39 @@ namespace core {
 	}
 
 
+	TEST(NodeReplacer, Parallel) {
+		NodeManager manager;
+		IRBuilder builder(manager);
+
+		// build a DAG containing the node to be replaced at various places
+		TypePtr typeA = builder.genericType("A");
+		TypeList level = toVector(typeA, builder.genericType("B"), builder.genericType("C"));
+		for(int d = 0; d < 6; d++) {
+			TypeList next;
+			for(int i = 0; i < 3; i++) {
+				next.push_back(builder.genericType("N" + toString(d) + "_" + toString(i), toVector(level[i], level[(i + 1) % 3], level[(i + 2) % 3])));
+			}
+			level = next;
+		}
+		NodePtr root = builder.tupleType(level);
+
+		NodeMap replacements;
+		replacements[typeA] = builder.genericType("D");
+		NodePtr expected = transform::replaceAll(manager, root, replacements, transform::globalReplacement);
+		EXPECT_NE(expected, root);
+
+		// use a small threshold to enforce concurrent processing
+		for(unsigned threads : { 1, 2, 4, 8 }) {
+			EXPECT_EQ(expected, transform::replaceAllParallel(manager, root, replacements, transform::globalReplacement, threads, 2)) << "Threads: " << threads;
+		}
+
+		// interrupted replacements produce the same result as the sequential version
+		auto limiter = [&](const NodePtr& node) {
+			return (node == level[1]) ? transform::ReplaceAction::Interrupt : transform::ReplaceAction::Process;
+		};
+		EXPECT_EQ(transform::replaceAll(manager, root, replacements, limiter), transform::replaceAllParallel(manager, root, replacements, limiter, 4, 2));
+	}
+
 	TEST(NodeReplacer, SkipperTest) {
 		NodeManager manager;
 		IRBuilder builder(manager);
@@ -979,6 +979,23 @@ namespace parser {
 	}
 
 
+	TEST(IR_Parser, TypeAliasResolution) {
+		NodeManager nm;
+		IRBuilder builder(nm);
+
+		TypeAliasMap aliases;
+		aliases[builder.parseType("A<'a>").as<GenericTypePtr>()] = builder.parseType("B<'a>");
+		aliases[builder.parseType("B<'a>").as<GenericTypePtr>()] = builder.parseType("C<'a,'a>");
+
+		// aliases are applied transitively
+		EXPECT_EQ(builder.parseType("C<int<4>,int<4>>"), parseType(nm, "A<int<4>>", true, DefinitionMap(), aliases));
+		EXPECT_EQ(builder.parseType("C<int<4>,int<4>>"), parseType(nm, "B<int<4>>", true, DefinitionMap(), aliases));
+
+		// nested and other types are not affected
+		EXPECT_EQ(builder.parseType("D<C<int<4>,int<4>>>"), parseType(nm, "D<A<int<4>>>", true, DefinitionMap(), aliases));
+		EXPECT_EQ(builder.parseType("(A,int<4>)"), parseType(nm, "(A,int<4>)", true, DefinitionMap(), aliases));
+	}
+
 	TEST(IR_Parser, Tuples) {
 		NodeManager nm;
 
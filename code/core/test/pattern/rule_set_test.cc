@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include <gtest/gtest.h>
+
+#include "insieme/core/ir_builder.h"
+
+#include "insieme/core/pattern/rule_set.h"
+#include "insieme/core/pattern/ir_pattern.h"
+#include "insieme/core/pattern/ir_generator.h"
+#include "insieme/core/pattern/variable.h"
+
+namespace insieme {
+namespace core {
+namespace pattern {
+
+namespace p = pattern;
+namespace g = pattern::generator;
+
+using namespace generator;
+
+TEST(RuleSet, RootFilter) {
+	NodeManager mgr;
+	IRBuilder builder(mgr);
+
+	EXPECT_TRUE(p::any.getRootFilter().anyType);
+	EXPECT_TRUE(p::var("x").getRootFilter().anyType);
+
+	auto filter = irp::compoundStmt(p::listVar("x")).getRootFilter();
+	EXPECT_FALSE(filter.anyType);
+	EXPECT_EQ(1u, filter.types.size());
+	EXPECT_EQ(1u, filter.types.count(NT_CompoundStmt));
+	EXPECT_TRUE(filter.covers(builder.compoundStmt()));
+	EXPECT_FALSE(filter.covers(builder.intLit(1)));
+
+	// disjunctions unite, conjunctions intersect the accepted types
+	filter = (irp::compoundStmt(p::listVar("x")) | irp::ifStmt(p::any, p::any, p::any)).getRootFilter();
+	EXPECT_EQ(2u, filter.types.size());
+	filter = (irp::compoundStmt(p::listVar("x")) & irp::ifStmt(p::any, p::any, p::any)).getRootFilter();
+	EXPECT_FALSE(filter.anyType);
+	EXPECT_TRUE(filter.types.empty());
+
+	// atoms are restricted to the matched node
+	auto one = builder.intLit(1);
+	filter = irp::atom(one).getRootFilter();
+	EXPECT_TRUE(filter.covers(one));
+	EXPECT_FALSE(filter.covers(builder.intLit(2)));
+}
+
+TEST(RuleSet, Candidates) {
+	NodeManager mgr;
+	IRBuilder builder(mgr);
+
+	auto one = builder.intLit(1);
+	auto two = builder.intLit(2);
+
+	RuleSet rules(toVector(
+		Rule(irp::compoundStmt(p::listVar("x") << irp::compoundStmt() << p::listVar("y")), irg::compoundStmt(g::listVar("x") << g::listVar("y"))),
+		Rule(irp::atom(one), g::atom(two)),
+		Rule()
+	));
+
+	EXPECT_EQ(toVector(0u, 2u), rules.getCandidates(NT_CompoundStmt));
+	EXPECT_EQ(toVector(1u, 2u), rules.getCandidates(NT_Literal));
+	EXPECT_EQ(toVector(2u), rules.getCandidates(NT_IfStmt));
+
+	// the rules are attempted in order
+	EXPECT_EQ(two, rules.applyTo(one));
+	EXPECT_EQ(two, rules.applyTo(two));
+	EXPECT_EQ("{1;}", toString(*rules.applyTo(builder.compoundStmt(one, builder.compoundStmt()))));
+
+	// rules not covering the type of a node are not attempted
+	RuleSet single(toVector(Rule(irp::atom(one), g::atom(two))));
+	EXPECT_FALSE(single.applyTo(builder.compoundStmt()));
+	EXPECT_EQ(0u, single.getNumAttempts());
+	EXPECT_EQ(1u, single.getNumSkipped());
+
+	// neither are rules whose atom differs
+	EXPECT_FALSE(single.applyTo(two));
+	EXPECT_EQ(0u, single.getNumAttempts());
+	EXPECT_EQ(2u, single.getNumSkipped());
+
+	EXPECT_EQ(two, single.applyTo(one));
+	EXPECT_EQ(1u, single.getNumAttempts());
+}
+
+TEST(RuleSet, FixpointNested) {
+	NodeManager mgr;
+	IRBuilder builder(mgr);
+
+	ListVariable xs = "x";
+	ListVariable ys = "y";
+
+	Rule rule(irp::compoundStmt(xs << irp::compoundStmt() << ys), irg::compoundStmt(xs << ys));
+	RuleSet rules(toVector(rule));
+
+	auto a = builder.intLit(1);
+
+	auto c = builder.compoundStmt(a, builder.compoundStmt(), a, builder.compoundStmt(builder.compoundStmt()),
+	                              builder.compoundStmt(builder.compoundStmt(builder.compoundStmt())), builder.compoundStmt(builder.compoundStmt(), a),
+	                              builder.compoundStmt(), a);
+
+	EXPECT_EQ("{1; {}; 1; {{};}; {{{};};}; {{}; 1;}; {}; 1;}", toString(*c));
+	EXPECT_EQ(toString(*rule.fixpoint(c)), toString(*rules.fixpoint(c)));
+	EXPECT_EQ("{1; 1; {1;}; 1;}", toString(*rules.fixpointNested(c)));
+	EXPECT_EQ(toString(*rule.fixpointNested(c)), toString(*rules.fixpointNested(c)));
+
+	// nothing to be done on a DAG without empty compounds
+	EXPECT_FALSE(rules.applyToNested(builder.compoundStmt(a, a)));
+
+	// failed sub-DAGs are not searched again
+	MatchFailureMemo memo;
+	auto d = builder.compoundStmt(builder.compoundStmt(a, a), builder.compoundStmt(a, a));
+	EXPECT_FALSE(rules.applyToNested(d, memo));
+	EXPECT_EQ(1u, memo.failedSubDAGs.count(d.ptr));
+	unsigned attempts = rules.getNumAttempts();
+	EXPECT_FALSE(rules.applyToNested(d, memo));
+	EXPECT_EQ(attempts, rules.getNumAttempts());
+}
+
+} // end namespace pattern
+} // end namespace core
+} // end namespace insieme
@@ -109,6 +109,75 @@ namespace tu {
 		EXPECT_EQ(toString(unit), toString(unitB));
 	}
 
+	TEST(TranslationUnit, LazyIO) {
+		core::NodeManager mgr;
+		core::IRBuilder builder(mgr);
+
+		// create a dummy translation unit
+		IRTranslationUnit unit(mgr);
+		unit.addType(builder.parseType("A").as<core::GenericTypePtr>(), builder.parseType("struct { x: int<4>; }").as<TagTypePtr>());
+		unit.addFunction(builder.parseExpr("lit(\"X\":()->unit)").as<core::LiteralPtr>(),
+		                 builder.parseExpr("()->unit { return; }").as<core::LambdaExprPtr>());
+		unit.addGlobal(builder.parseExpr("lit(\"a\":ref<int<4>>)").as<core::LiteralPtr>(), builder.parseExpr("12"));
+		unit.addEntryPoints(builder.parseExpr("lit(\"X\":()->unit)").as<core::LiteralPtr>());
+
+		// dump unit in the indexed format
+		stringstream buffer(ios_base::out | ios_base::in | ios_base::binary);
+		dumpIndexed(buffer, unit);
+		EXPECT_TRUE(dump::binary::isIndexedIR(buffer));
+
+		// reload unit lazily
+		core::NodeManager managerB;
+		LazyIRTranslationUnit lazy(managerB, std::make_shared<dump::binary::LazyIRLoader>(managerB, buffer.str()));
+		EXPECT_TRUE(lazy.isDefined(builder.parseType("A")));
+		EXPECT_FALSE(lazy.isDefined(builder.parseType("B")));
+		EXPECT_EQ(1, lazy.getBase().getGlobals().size());
+		EXPECT_EQ(1, lazy.getEntryPoints().size());
+
+		// the fully restored unit should be equal
+		EXPECT_EQ(toString(unit), toString(lazy.materialize()));
+	}
+
+	TEST(TranslationUnit, LazyLink) {
+		core::NodeManager mgr;
+		core::IRBuilder builder(mgr);
+
+		auto x = builder.parseExpr("lit(\"X\":()->unit)").as<core::LiteralPtr>();
+		auto y = builder.parseExpr("lit(\"Y\":()->unit)").as<core::LiteralPtr>();
+		auto z = builder.parseExpr("lit(\"Z\":()->unit)").as<core::LiteralPtr>();
+		auto main = builder.parseExpr("lit(\"main\":()->unit)").as<core::LiteralPtr>();
+
+		// a library where X is calling Y while Z is not used at all
+		IRTranslationUnit lib(mgr);
+		lib.addFunction(x, builder.parseExpr("()->unit { lit(\"Y\":()->unit)(); }").as<core::LambdaExprPtr>());
+		lib.addFunction(y, builder.parseExpr("()->unit { return; }").as<core::LambdaExprPtr>());
+		lib.addFunction(z, builder.parseExpr("()->unit { var int<4> v = 5; return; }").as<core::LambdaExprPtr>());
+
+		stringstream buffer(ios_base::out | ios_base::in | ios_base::binary);
+		dumpIndexed(buffer, lib);
+
+		// the unit using the library
+		IRTranslationUnit unit(mgr);
+		unit.addFunction(main, builder.parseExpr("()->unit { lit(\"X\":()->unit)(); }").as<core::LambdaExprPtr>());
+		unit.addEntryPoints(main);
+
+		// link the library, only restoring the used definitions
+		core::NodeManager managerB;
+		auto loader = std::make_shared<dump::binary::LazyIRLoader>(managerB, buffer.str());
+		LazyIRTranslationUnit lazy(managerB, loader);
+		auto linked = link(managerB, unit, toVector(lazy));
+
+		EXPECT_TRUE(linked[x]);
+		EXPECT_TRUE(linked[y]);
+		EXPECT_FALSE(linked[z]);
+		EXPECT_TRUE(linked[main]);
+		EXPECT_EQ(1, linked.getEntryPoints().size());
+		EXPECT_LT(loader->getNumMaterializedNodes(), loader->getNumNodes());
+
+		// the resulting program is the same as the one obtained from the eagerly merged units
+		EXPECT_EQ(*toProgram(mgr, merge(mgr, lib, unit)), *toProgram(managerB, linked));
+	}
+
 	TEST(TranslationUnit, IR) {
 		core::NodeManager mgr;
 		core::IRBuilder builder(mgr);
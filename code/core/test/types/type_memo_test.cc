@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include <gtest/gtest.h>
+
+#include "insieme/core/types/type_memo.h"
+#include "insieme/core/types/subtyping.h"
+#include "insieme/core/types/unification.h"
+#include "insieme/core/types/return_type_deduction.h"
+#include "insieme/core/ir_builder.h"
+
+#include "insieme/utils/string_utils.h"
+
+namespace insieme {
+namespace core {
+namespace types {
+
+	TEST(TypeMemo, SubTyping) {
+		NodeManager manager;
+		IRBuilder builder(manager);
+		const auto& basic = manager.getLangBasic();
+		auto& memo = manager.getTypeMemo();
+
+		TypePtr int4 = basic.getInt4();
+		TypePtr int8 = basic.getInt8();
+
+		EXPECT_TRUE(isSubTypeOf(int4, int8));
+		unsigned misses = memo.subTypes.getNumMisses();
+		EXPECT_LT(0u, misses);
+		EXPECT_EQ(0u, memo.subTypes.getNumHits());
+
+		// the same question is answered by the memo table
+		EXPECT_TRUE(isSubTypeOf(int4, int8));
+		EXPECT_FALSE(isSubTypeOf(int8, int4));
+		EXPECT_FALSE(isSubTypeOf(int8, int4));
+		EXPECT_EQ(2u, memo.subTypes.getNumHits());
+		EXPECT_EQ(misses + 1, memo.subTypes.getNumMisses());
+
+		// join and meet types are memorized separately
+		EXPECT_EQ(int8, getSmallestCommonSuperType(int4, int8));
+		EXPECT_EQ(int4, getBiggestCommonSubType(int4, int8));
+		EXPECT_EQ(int8, getSmallestCommonSuperType(int4, int8));
+		EXPECT_EQ(1u, memo.joinTypes.getNumHits());
+		EXPECT_EQ(0u, memo.meetTypes.getNumHits());
+
+		EXPECT_PRED2(containsSubString, toString(memo), "isSubTypeOf");
+	}
+
+	TEST(TypeMemo, Unification) {
+		NodeManager manager;
+		IRBuilder builder(manager);
+		auto& memo = manager.getTypeMemo();
+
+		TypePtr typeA = builder.parseType("set<'a>");
+		TypePtr typeB = builder.parseType("set<int<4>>");
+		TypePtr typeC = builder.parseType("list<int<4>>");
+
+		auto res = unify(manager, typeA, typeB);
+		ASSERT_TRUE(res);
+		EXPECT_EQ(*typeB, *res->applyTo(typeA));
+		EXPECT_FALSE(unify(manager, typeA, typeC));
+
+		// repeated requests are answered by the memo table
+		EXPECT_EQ(toString(*res), toString(*unify(manager, typeA, typeB)));
+		EXPECT_FALSE(unify(manager, typeA, typeC));
+		EXPECT_EQ(2u, memo.unifiers.getNumHits());
+		EXPECT_EQ(2u, memo.unifiers.getNumMisses());
+
+		// types of other managers are not memorized
+		NodeManager other;
+		EXPECT_TRUE(unify(other, typeA, typeB));
+		EXPECT_EQ(2u, memo.unifiers.getNumMisses());
+		EXPECT_EQ(0u, other.getTypeMemo().unifiers.getNumMisses());
+	}
+
+	TEST(TypeMemo, ReturnTypeDeduction) {
+		NodeManager manager;
+		IRBuilder builder(manager);
+		auto& memo = manager.getTypeMemo();
+
+		FunctionTypePtr funType = builder.parseType("('a, 'a) -> 'a").as<FunctionTypePtr>();
+		TypeList args = toVector(builder.parseType("int<4>"), builder.parseType("int<4>"));
+
+		EXPECT_EQ("int<4>", toString(*deduceReturnType(funType, args)));
+		EXPECT_EQ("int<4>", toString(*deduceReturnType(funType, args)));
+		EXPECT_EQ(1u, memo.returnTypes.getNumHits());
+		EXPECT_EQ(1u, memo.returnTypes.getNumMisses());
+
+		// failures are not memorized
+		TypeList wrong = toVector(builder.parseType("int<4>"));
+		EXPECT_THROW(tryDeduceReturnType(funType, wrong), ReturnTypeDeductionException);
+		EXPECT_THROW(tryDeduceReturnType(funType, wrong), ReturnTypeDeductionException);
+		EXPECT_EQ(1u, memo.returnTypes.getNumHits());
+	}
+
+} // end namespace types
+} // end namespace core
+} // end namespace insieme
@@ -45,6 +45,7 @@ namespace core {
 	class NodeManager;
 namespace tu {
 	class IRTranslationUnit;
+	class LazyIRTranslationUnit;
 }
 }
 namespace frontend {
@@ -61,6 +62,15 @@ namespace utils {
 	 */
 	bool isInsiemeLib(const boost::filesystem::path& file);
 
+	/**
+	 * Checks whether the given file is a Insieme library file stored in the indexed format,
+	 * enabling its definitions to be loaded on demand.
+	 *
+	 * @param file the file to be tested
+	 * @return true if so, false otherwise
+	 */
+	bool isLazyInsiemeLib(const boost::filesystem::path& file);
+
 	/**
 	 * Loads an Insieme library file.
 	 *
@@ -71,7 +81,17 @@ namespace utils {
 	core::tu::IRTranslationUnit loadLib(core::NodeManager& mgr, const boost::filesystem::path& file);
 
 	/**
-	 * Saves an Insieme library to a file.
+	 * Maps an Insieme library file stored in the indexed format into memory. Only symbols
+	 * are restored immediately, definitions are restored when being used.
+	 *
+	 * @param mgr the node manager to maintain the resulting IR nodes
+	 * @param file the library to be loaded
+	 * @return the lazily loaded translation unit
+	 */
+	core::tu::LazyIRTranslationUnit loadLazyLib(core::NodeManager& mgr, const boost::filesystem::path& file);
+
+	/**
+	 * Saves an Insieme library to a file, using the indexed format.
 	 *
 	 * @param unit the translation unit to be saved
 	 * @param file the target location
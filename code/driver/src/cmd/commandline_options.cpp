@@ -184,6 +184,7 @@ namespace cmd {
 		res.job.setOption(frontend::ConversionJob::NoWarnings, res.settings.noWarnings);
 		res.job.setOption(frontend::ConversionJob::NoColor, res.settings.noColor);
 		res.job.setOption(frontend::ConversionJob::NoDefaultExtensions, res.settings.noDefaultExtensions);
+		res.job.setNumThreads(res.settings.frontendThreads);
 
 		res.job.setOption(frontend::ConversionJob::DumpClangAST, res.settings.printClangAST);
 		// set clang AST dump filter regex
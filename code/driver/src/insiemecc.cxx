@@ -41,12 +41,14 @@
 
 #include "insieme/utils/logging.h"
 #include "insieme/utils/compiler/compiler.h"
+#include "insieme/utils/disk_cache.h"
 #include "insieme/utils/version.h"
 
 #include "insieme/frontend/frontend.h"
 #include "insieme/frontend/utils/file_extensions.h"
 
 #include "insieme/backend/backend.h"
+#include "insieme/backend/c_ast/c_code.h"
 
 #include "insieme/driver/cmd/commandline_options.h"
 #include "insieme/driver/cmd/common_options.h"
@@ -74,6 +76,7 @@ int main(int argc, char** argv) {
 	bool showStatistics = false;
 	bool taskGranularityTuning = false;
 	std::string backendString;
+	unsigned backendUnits = 1;
 	frontend::path dumpCFG, dumpJSON, dumpTree, dumpTU, dumpOclKernel;
 	std::vector<std::string> optimizationFlags;
 
@@ -87,6 +90,7 @@ int main(int argc, char** argv) {
 	parser.addFlag(     "benchmark-core",          benchmarkCore,                                 "benchmarking of some standard core operations on the intermediate representation");
 	parser.addFlag(     "task-granularity-tuning", taskGranularityTuning,                         "enables multiverisoning of parallel tasks");
 	parser.addParameter("backend",                 backendString,     std::string("runtime"),     "backend selection");
+	parser.addParameter("backend-units",           backendUnits,      1u,                         "number of translation units the target code is split into for compiling it in parallel");
 	parser.addParameter("dump-cfg",                dumpCFG,           frontend::path(),           "print dot graph of the CFG");
 	parser.addParameter("dump-tree",               dumpTree,          frontend::path(),           "dump intermediate representation (Tree)");
 	parser.addParameter("dump-json",               dumpJSON,          frontend::path(),           "dump intermediate representation (JSON)");
@@ -116,6 +120,7 @@ int main(int argc, char** argv) {
 	// if it is compile only or if it should become an object file => save it
 	if(commonOptions.compileOnly || createSharedObject) {
 		auto res = options.job.toIRTranslationUnit(mgr);
+		if(auto cache = utils::cache::DiskCache::getDefault()) { std::cout << *cache << "\n"; }
 		std::cout << "Saving object file ...\n";
 		driver::utils::saveLib(res, commonOptions.outFile);
 		return driver::utils::isInsiemeLib(commonOptions.outFile) ? 0 : 1;
@@ -174,6 +179,7 @@ int main(int argc, char** argv) {
 	backend::BackendPtr backend = driver::utils::getBackend(backendString, dumpOclKernel.string());
 	if(!backend) { return 1; }
 	auto targetCode = backend->convert(program);
+	if(auto cache = utils::cache::DiskCache::getDefault()) { std::cout << *cache << "\n"; }
 
 	// dump target code
 	{
@@ -236,5 +242,23 @@ int main(int argc, char** argv) {
 		compiler.addFlag("-std=c99");
 	}
 
+	// split the target code into multiple translation units to be compiled in parallel if requested
+	auto cCode = std::dynamic_pointer_cast<backend::c_ast::CCode>(targetCode);
+	if(backendUnits > 1 && cCode) {
+		frontend::path base = commonOptions.outFile;
+		base.concat("_generated");
+		auto units = cCode->toTranslationUnits(backendUnits, base.filename().string() + ".h");
+
+		std::ofstream(base.string() + ".h") << units.header;
+		std::vector<std::string> files;
+		for(unsigned i = 0; i < units.units.size(); i++) {
+			files.push_back(base.string() + "_" + toString(i) + (options.job.isCxx() ? ".cpp" : ".c"));
+			std::ofstream(files.back()) << units.units[i];
+		}
+
+		std::cout << "Compiling " << files.size() << " translation units ...\n";
+		return !insieme::utils::compiler::compileInParallel(files, commonOptions.outFile.string(), compiler);
+	}
+
 	return !insieme::utils::compiler::compileToBinary(*targetCode, commonOptions.outFile.string(), compiler);
 }
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include <fstream>
+
+#include <boost/program_options.hpp>
+
+#include "insieme/core/ir_builder.h"
+#include "insieme/core/lang/extension_registry.h"
+#include "insieme/core/lang/extension_snapshot.h"
+
+#include "insieme/utils/timer.h"
+
+using namespace std;
+using namespace insieme;
+namespace opts = boost::program_options;
+
+/**
+ * A driver producing a snapshot of the constructs defined by the basic language and all named
+ * language extensions. The resulting file may be referenced by the INSIEME_LANG_SNAPSHOT
+ * environment variable to skip the parsing of those constructs on startup.
+ */
+
+namespace {
+
+	/**
+	 * Instantiates the basic language and all named language extensions within the given manager,
+	 * including all of their named constructs.
+	 */
+	void initLanguage(core::NodeManager& mgr) {
+		// parsing anything is initializing all builtins of the basic language
+		core::IRBuilder(mgr).parseType("unit");
+
+		// instantiate all named extensions and their symbols
+		for(const auto& factory : core::lang::ExtensionRegistry::getInstance().getExtensionFactories()) {
+			const auto& ext = factory.second(mgr);
+			for(const auto& symbol : ext.getSymbols()) {
+				symbol.second();
+			}
+		}
+	}
+
+}
+
+int main(int argc, char** argv) {
+	// define options
+	opts::options_description desc("Supported Parameters");
+	desc.add_options()
+		("help,h", "produce help message")
+		("output,o", opts::value<string>()->default_value("lang.snapshot"), "the file to write the snapshot to")
+		("benchmark,b", opts::value<unsigned>()->default_value(0), "the number of node managers to be initialized using the snapshot");
+
+	// parse parameters
+	opts::variables_map map;
+	opts::store(opts::command_line_parser(argc, argv).options(desc).run(), map);
+	opts::notify(map);
+
+	if(map.count("help")) {
+		cout << desc << "\n";
+		return 0;
+	}
+
+	auto outFile = map["output"].as<string>();
+	auto rounds = map["benchmark"].as<unsigned>();
+
+	auto& snapshot = core::lang::ExtensionSnapshot::getDefault();
+
+	// record all constructs
+	{
+		core::NodeManager mgr;
+		auto time = TIME(initLanguage(mgr));
+		cout << "Initialized language by parsing " << snapshot.getNumMisses() << " constructs in " << time << " seconds\n";
+	}
+
+	// write snapshot
+	{
+		ofstream out(outFile, ios::binary);
+		snapshot.store(out);
+		if(!out) {
+			cerr << "Unable to write snapshot to " << outFile << "\n";
+			return 1;
+		}
+		cout << "Written " << snapshot.size() << " constructs to " << outFile << "\n";
+	}
+
+	// benchmark the initialization of fresh managers based on the snapshot
+	if(rounds > 0) {
+		// the cost of loading the file is what a fresh process is paying instead of the parsing
+		core::lang::ExtensionSnapshot loaded;
+		ifstream in(outFile, ios::binary);
+		auto time = TIME(loaded.load(in));
+		cout << "Loaded snapshot in " << time << " seconds\n";
+
+		unsigned misses = snapshot.getNumMisses();
+		time = TIME(for(unsigned i = 0; i < rounds; i++) {
+			core::NodeManager mgr;
+			initLanguage(mgr);
+		});
+		cout << "Initialized language " << rounds << " times using the snapshot in " << time << " seconds (" << (time / rounds) << " seconds each, "
+		     << (snapshot.getNumMisses() - misses) << " constructs parsed)\n";
+	}
+
+	return 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <limits>
+
+#include <boost/program_options.hpp>
+
+#include "insieme/core/ir_builder.h"
+#include "insieme/core/parser/ir_parser.h"
+#include "insieme/core/lang/array.h"
+#include "insieme/core/lang/channel.h"
+#include "insieme/core/lang/extension_registry.h"
+#include "insieme/core/lang/extension_snapshot.h"
+#include "insieme/core/lang/io.h"
+#include "insieme/core/lang/parallel.h"
+#include "insieme/core/lang/reference.h"
+
+#include "insieme/utils/timer.h"
+
+using namespace std;
+using namespace insieme;
+namespace opts = boost::program_options;
+
+/**
+ * A driver benchmarking the IR parser. It measures the time for parsing the definitions of the basic language and all
+ * named language extensions as well as the time for parsing the given IR input files (e.g. core/test/parser/inputs).
+ */
+
+namespace {
+
+	/**
+	 * Instantiates the basic language and all named language extensions within the given manager,
+	 * including all of their named constructs.
+	 */
+	void initLanguage(core::NodeManager& mgr) {
+		// parsing anything is initializing all builtins of the basic language
+		core::IRBuilder(mgr).parseType("unit");
+
+		// instantiate all named extensions and their symbols
+		for(const auto& factory : core::lang::ExtensionRegistry::getInstance().getExtensionFactories()) {
+			const auto& ext = factory.second(mgr);
+			for(const auto& symbol : ext.getSymbols()) {
+				symbol.second();
+			}
+		}
+	}
+
+	/**
+	 * Parses the given program using the same symbols and aliases as the parser input tests.
+	 */
+	core::NodePtr parseInput(core::NodeManager& mgr, const string& code) {
+		core::parser::DefinitionMap definitions;
+		core::parser::TypeAliasMap aliases;
+
+		auto addExtension = [&](const core::lang::Extension& ext) {
+			definitions.insert(ext.getDefinedSymbols().begin(), ext.getDefinedSymbols().end());
+			aliases.insert(ext.getTypeAliases().begin(), ext.getTypeAliases().end());
+		};
+		addExtension(mgr.getLangExtension<core::lang::ArrayExtension>());
+		addExtension(mgr.getLangExtension<core::lang::ReferenceExtension>());
+		addExtension(mgr.getLangExtension<core::lang::ParallelExtension>());
+		addExtension(mgr.getLangExtension<core::lang::ChannelExtension>());
+		addExtension(mgr.getLangExtension<core::lang::InputOutputExtension>());
+
+		return core::parser::parseProgram(mgr, code, false, definitions, aliases);
+	}
+
+}
+
+int main(int argc, char** argv) {
+	// define options
+	opts::options_description desc("Supported Parameters");
+	desc.add_options()
+		("help,h", "produce help message")
+		("input,i", opts::value<vector<string>>()->default_value(vector<string>(), ""), "the IR files to be parsed")
+		("repetitions,r", opts::value<unsigned>()->default_value(5), "the number of times each input file is parsed");
+
+	// define positional options (all options not being named)
+	opts::positional_options_description pos;
+	pos.add("input", -1);
+
+	// parse parameters
+	opts::variables_map map;
+	opts::store(opts::command_line_parser(argc, argv).options(desc).positional(pos).run(), map);
+	opts::notify(map);
+
+	if(map.count("help")) {
+		cout << desc << "\n";
+		return 0;
+	}
+
+	auto inputFiles = map["input"].as<vector<string>>();
+	auto rounds = std::max(map["repetitions"].as<unsigned>(), 1u);
+
+	// the constructs of the language extensions are only parsed once per process (unless loaded from a snapshot)
+	{
+		auto& snapshot = core::lang::ExtensionSnapshot::getDefault();
+		unsigned misses = snapshot.getNumMisses();
+		core::NodeManager mgr;
+		auto time = TIME(initLanguage(mgr));
+		cout << "Initialized language by parsing " << (snapshot.getNumMisses() - misses) << " constructs in " << time << " seconds\n";
+	}
+
+	// parse the input files, each time using a fresh node manager
+	for(const auto& file : inputFiles) {
+		stringstream code;
+		code << ifstream(file).rdbuf();
+		auto size = code.str().size();
+
+		double best = std::numeric_limits<double>::max();
+		double total = 0;
+		for(unsigned i = 0; i < rounds; i++) {
+			core::NodeManager mgr;
+			initLanguage(mgr);
+
+			core::NodePtr res;
+			auto time = TIME(res = parseInput(mgr, code.str()));
+			if(!res) {
+				cerr << "Unable to parse " << file << "\n";
+				return 1;
+			}
+
+			best = std::min(best, time);
+			total += time;
+		}
+
+		cout << "Parsed " << file << " (" << size << " bytes) in " << best << " seconds (best), " << (total / rounds) << " seconds (average) - "
+		     << (size / best / 1e6) << " MB/s\n";
+	}
+
+	return 0;
+}
@@ -49,8 +49,10 @@
 #include "insieme/driver/cmd/commandline_options.h"
 
 #include "insieme/core/ir_node.h"
+#include "insieme/core/ir_builder.h"
 #include "insieme/core/dump/binary_dump.h"
 
+#include "insieme/core/checks/full_check.h"
 #include "insieme/core/checks/ir_checks.h"
 #include "insieme/core/checks/imperative_checks.h"
 #include "insieme/core/checks/type_checks.h"
@@ -183,6 +185,25 @@ int main(int argc, char** argv) {
 		);
 
 		std::cout << "done (took " << time << " seconds)\n";
+
+		std::cout << "Benchmarking full check ... " << std::endl;
+
+		// the first run is checking all nodes, subsequent runs skip sub-DAGs found to be correct
+		core::checks::MessageList fullResult;
+		time = TIME(fullResult = core::checks::check(program));
+		if(fullResult.size() != 0) std::cout << "Semantic errors encountered!\n\n" << fullResult << std::endl;
+		std::cout << "Initial full check took: " << time << " seconds\n";
+
+		time = TIME(core::checks::check(program));
+		std::cout << "Re-check of unchanged program took: " << time << " seconds\n";
+
+		// a small modification only requires the modified part to be checked
+		if(auto prog = program.isa<core::ProgramPtr>()) {
+			core::IRBuilder builder(mgr);
+			auto modified = core::Program::addEntryPoint(mgr, prog, builder.parseExpr("() -> unit { }"));
+			time = TIME(core::checks::check(modified));
+			std::cout << "Re-check of modified program took: " << time << " seconds\n";
+		}
 	}
 
 	return 0;
@@ -40,6 +40,7 @@
 #include <algorithm>
 #include <string>
 #include <iomanip>
+#include <sstream>
 #include <vector>
 
 #include <boost/algorithm/string/replace.hpp>
@@ -48,11 +49,16 @@
 #include "insieme/backend/sequential/sequential_backend.h"
 #include "insieme/backend/opencl/opencl_backend.h"
 
+#include "insieme/core/arithmetic/arithmetic_utils.h"
 #include "insieme/core/checks/full_check.h"
 #include "insieme/core/checks/ir_checks.h"
+#include "insieme/core/dump/binary_dump.h"
+#include "insieme/core/ir_builder.h"
 #include "insieme/core/ir_node.h"
 #include "insieme/core/ir_statistic.h"
 #include "insieme/core/printer/error_printer.h"
+#include "insieme/core/types/return_type_deduction.h"
+#include "insieme/core/types/type_memo.h"
 
 #include "insieme/utils/timer.h"
 #include "insieme/utils/compiler/compiler.h"
@@ -94,6 +100,7 @@ namespace utils {
 	void showStatistics(const core::ProgramPtr& program) {
 		openBoxTitle("IR Statistics");
 		iu::measureTimeFor<INFO>("ir.statistics ", [&]() { LOG(INFO) << "\n" << core::IRStatistic::evaluate(program); });
+		LOG(INFO) << "Type operation memo tables:\n" << program->getNodeManager().getTypeMemo();
 		closeBox();
 	}
 
@@ -119,6 +126,26 @@ namespace utils {
 		});
 		LOG(INFO) << "Number of nodes: " << count;
 
+		// Benchmark address based visitor retaining the addresses - equal addresses derived from the same root share their storage
+		{
+			core::ProgramAddress root(program);
+			std::vector<core::NodeAddress> first;
+			std::vector<core::NodeAddress> second;
+			iu::measureTimeFor<INFO>("Benchmark.CollectAll.Address ", [&]() {
+				core::visitDepthFirst(root, core::makeLambdaVisitor([&](const core::NodeAddress& cur) { first.push_back(cur); }, true));
+			});
+			iu::measureTimeFor<INFO>("Benchmark.CollectAll.Address.Interned ", [&]() {
+				core::visitDepthFirst(root, core::makeLambdaVisitor([&](const core::NodeAddress& cur) { second.push_back(cur); }, true));
+			});
+			std::size_t shared = 0;
+			iu::measureTimeFor<INFO>("Benchmark.CompareAll.Address ", [&]() {
+				for(std::size_t i = 0; i < first.size(); i++) {
+					if(first[i].getPath().isIdentical(second[i].getPath())) { shared++; }
+				}
+			});
+			LOG(INFO) << "Number of addresses: " << first.size() << " - shared: " << shared;
+		}
+
 		// Benchmark empty-substitution operation
 		count = 0;
 		iu::measureTimeFor<INFO>("Benchmark.IterateAll.Address ", [&]() {
@@ -145,6 +172,101 @@ namespace utils {
 			mapper2.map(0, program);
 		});
 		LOG(INFO) << "Number of modifications: " << count;
+
+		// Benchmark cloning the program into a fresh manager (node allocation)
+		{
+			core::NodeManager fresh;
+			iu::measureTimeFor<INFO>("Benchmark.CloneToManager ", [&]() { fresh.get(program); });
+			LOG(INFO) << "Number of nodes: " << fresh.size();
+			LOG(INFO) << "Node memory allocated / reserved: " << fresh.getArena().getAllocatedBytes() << " / " << fresh.getArena().getReservedBytes() << " bytes";
+		}
+
+		// Benchmark return type deduction - all calls are re-typed twice within a fresh manager, the second round is answered by its memo tables
+		{
+			core::NodeManager fresh;
+			std::vector<core::CallExprPtr> calls;
+			core::visitDepthFirstOnce(fresh.get(program), [&](const core::CallExprPtr& call) { calls.push_back(call); });
+			for(const std::string round : {"Cold", "Warm"}) {
+				iu::measureTimeFor<INFO>("Benchmark.Types.ReturnTypes." + round + " ", [&]() {
+					for(const auto& call : calls) {
+						if(auto funType = call->getFunctionExpr()->getType().isa<core::FunctionTypePtr>()) {
+							core::types::deduceReturnType(funType, core::extractTypes(call->getArgumentList()), false);
+						}
+					}
+				});
+			}
+			LOG(INFO) << "Number of calls: " << calls.size() << "\n" << fresh.getTypeMemo();
+		}
+
+		// Benchmark arithmetic operations on the bounds of all for loops
+		{
+			namespace ar = core::arithmetic;
+			std::vector<core::ExpressionPtr> bounds;
+			core::visitDepthFirstOnce(program, [&](const core::ForStmtPtr& loop) {
+				bounds.push_back(loop->getStart());
+				bounds.push_back(loop->getEnd());
+				bounds.push_back(loop->getStep());
+			});
+			std::vector<ar::Formula> formulas;
+			for(const std::string round : {"Cold", "Warm"}) {
+				formulas.clear();
+				iu::measureTimeFor<INFO>("Benchmark.Arithmetic.ToFormula." + round + " ", [&]() {
+					for(const auto& cur : bounds) {
+						try {
+							formulas.push_back(ar::toFormula(cur));
+						} catch(const ar::NotAFormulaException&) {}
+					}
+				});
+			}
+			LOG(INFO) << "Number of loop bounds: " << bounds.size() << " - formulas: " << formulas.size();
+
+			ar::Formula sum;
+			iu::measureTimeFor<INFO>("Benchmark.Arithmetic.Add ", [&]() {
+				for(const auto& cur : formulas) { sum += cur; }
+			});
+			std::size_t terms = 0;
+			iu::measureTimeFor<INFO>("Benchmark.Arithmetic.Mul ", [&]() {
+				for(std::size_t i = 1; i < formulas.size(); i++) { terms += (formulas[i - 1] * formulas[i]).getTerms().size(); }
+			});
+			iu::measureTimeFor<INFO>("Benchmark.Arithmetic.Substitute ", [&]() {
+				for(const auto& cur : formulas) {
+					ar::ValueReplacementMap replacements;
+					for(const auto& value : cur.extractValues()) { replacements[value] = ar::Formula(value) + 1; }
+					terms += cur.replace(replacements).getTerms().size();
+				}
+			});
+			std::size_t equal = 0;
+			iu::measureTimeFor<INFO>("Benchmark.Arithmetic.Piecewise ", [&]() {
+				for(std::size_t i = 1; i < formulas.size(); i++) {
+					ar::Piecewise a = ar::min(formulas[i - 1], formulas[i]);
+					ar::Piecewise b = ar::max(formulas[i], formulas[i - 1]);
+					if(a == b) { equal++; }
+				}
+			});
+			iu::measureTimeFor<INFO>("Benchmark.Arithmetic.ToIR ", [&]() {
+				for(const auto& cur : formulas) { ar::toIR(mgr, cur); }
+			});
+			LOG(INFO) << "Number of terms: " << terms << " - equal min/max pairs: " << equal;
+		}
+
+		// Benchmark the round trip through the binary dump formats
+		{
+			auto roundTrip = [&](const std::string& name, const std::function<void(std::ostream&)>& dump) {
+				std::stringstream buffer(std::ios_base::out | std::ios_base::in | std::ios_base::binary);
+				iu::Timer dumpTime("");
+				dump(buffer);
+				dumpTime.stop();
+				core::NodeManager fresh;
+				iu::Timer loadTime("");
+				core::dump::binary::loadIR(buffer, fresh);
+				loadTime.stop();
+				double mb = buffer.str().size() / (1024.0 * 1024.0);
+				LOG(INFO) << "Benchmark.Dump." << name << ": " << buffer.str().size() << " bytes - dump: " << dumpTime.getTime() << " s ("
+				          << mb / dumpTime.getTime() << " MB/s) - load: " << loadTime.getTime() << " s (" << mb / loadTime.getTime() << " MB/s)";
+			};
+			roundTrip("Binary", [&](std::ostream& out) { core::dump::binary::dumpIR(out, program); });
+			roundTrip("Compact", [&](std::ostream& out) { core::dump::binary::dumpCompactIR(out, program); });
+		}
 		closeBox();
 	}
 
@@ -44,6 +44,7 @@
 
 #include "insieme/core/tu/ir_translation_unit.h"
 #include "insieme/core/tu/ir_translation_unit_io.h"
+#include "insieme/core/dump/binary_dump.h"
 
 #include "insieme/frontend/frontend.h"
 #include "insieme/frontend/utils/file_extensions.h"
@@ -56,6 +57,17 @@ namespace utils {
 
 		// some magic number to identify our files
 		const long MAGIC_NUMBER = 42 * 42 * 42 * 42;
+
+		/**
+		 * Opens the given library and consumes the magic number, such that the stream is positioned
+		 * at the start of the dumped translation unit.
+		 */
+		void openLib(std::ifstream& in, const boost::filesystem::path& file) {
+			in.open(file.string(), std::ios::in | std::ios::binary);
+			long x;
+			in >> x;
+			assert(x == MAGIC_NUMBER);
+		}
 	}
 
 	bool isInsiemeLib(const boost::filesystem::path& file) {
@@ -73,28 +85,47 @@ namespace utils {
 		return x == MAGIC_NUMBER;
 	}
 
+	bool isLazyInsiemeLib(const boost::filesystem::path& file) {
+		if(!isInsiemeLib(file)) { return false; }
+		std::ifstream in;
+		openLib(in, file);
+		return core::dump::binary::isIndexedIR(in);
+	}
+
 	core::tu::IRTranslationUnit loadLib(core::NodeManager& mgr, const boost::filesystem::path& file) {
 		assert_true(isInsiemeLib(file));
 
-		// open file
-		std::ifstream in(file.string(), std::ios::in | std::ios::binary);
+		// libraries in the indexed format are restored entirely
+		if(isLazyInsiemeLib(file)) { return loadLazyLib(mgr, file).materialize(); }
 
-		// consume the magic number
-		long x;
-		in >> x;
-		assert(x == MAGIC_NUMBER);
+		// open file and consume the magic number
+		std::ifstream in;
+		openLib(in, file);
 
 		// load content
 		return core::tu::load(in, mgr);
 	}
 
+	core::tu::LazyIRTranslationUnit loadLazyLib(core::NodeManager& mgr, const boost::filesystem::path& file) {
+		assert_true(isLazyInsiemeLib(file));
+
+		// locate the dumped translation unit behind the magic number
+		std::ifstream in;
+		openLib(in, file);
+		std::size_t offset = in.tellg();
+
+		// map the file, nodes are restored on demand
+		std::shared_ptr<core::dump::binary::LazyIRLoader> loader = core::dump::binary::LazyIRLoader::mapFile(mgr, file.string(), offset);
+		return core::tu::LazyIRTranslationUnit(mgr, loader);
+	}
+
 	void saveLib(const core::tu::IRTranslationUnit& unit, const boost::filesystem::path& file) {
 		// create all necessary directory
 		boost::filesystem::create_directories(boost::filesystem::absolute(file).parent_path());
 
 		std::ofstream out(file.string(), std::ios::out | std::ios::binary);
-		out << MAGIC_NUMBER;           // start with magic number
-		core::tu::dump(out, unit); // dump the rest
+		out << MAGIC_NUMBER;                // start with magic number
+		core::tu::dumpIndexed(out, unit); // dump the rest, such that it may be loaded lazily
 
 		assert_true(boost::filesystem::exists(file));
 	}
@@ -104,10 +135,14 @@ namespace utils {
 		std::vector<frontend::path> libs;
 		std::vector<frontend::path> extLibs;
 
+		std::vector<frontend::path> lazyLibs;
+
 		for(const frontend::path& cur : job.getFiles()) {
 			auto ext = boost::filesystem::extension(cur);
 			if(ext == ".o" || ext == ".so") {
-				if(isInsiemeLib(cur)) {
+				if(isLazyInsiemeLib(cur)) {
+					lazyLibs.push_back(cur);
+				} else if(isInsiemeLib(cur)) {
 					libs.push_back(cur);
 				} else {
 					extLibs.push_back(cur);
@@ -129,6 +164,10 @@ namespace utils {
 			std::cout << "Loading " << cur << " ...\n";
 			return loadLib(mgr, cur);
 		}));
+		job.setLazyLibs(::transform(lazyLibs, [&](const frontend::path& cur) {
+			std::cout << "Mapping " << cur << " ...\n";
+			return loadLazyLib(mgr, cur);
+		}));
 		return true;
 	}
 
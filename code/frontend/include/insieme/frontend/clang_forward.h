@@ -53,6 +53,7 @@ namespace clang {
 	class FunctionDecl;
 	class VarDecl;
 	class TypeDecl;
+	class TagDecl;
 	class ValueDecl;
 
 	class CastExpr;
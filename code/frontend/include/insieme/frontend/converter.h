@@ -37,9 +37,11 @@
 
 #pragma once
 
+#include <map>
 #include <set>
 #include <memory>
 #include <functional>
+#include <vector>
 
 #include "insieme/frontend/clang_forward.h"
 #include "insieme/frontend/frontend.h"
@@ -164,6 +166,10 @@ namespace conversion {
 		///
 		std::set<clang::ClassTemplateSpecializationDecl*> instantiatedDecls;
 
+		/// A map from names of lambdas and local classes to the declarations using them, to tell different instantiations apart
+		///
+		mutable std::map<std::string, std::vector<const clang::TagDecl*>> instantiationNameMapping;
+
 		/**
 		 * Attach annotations to a C function of the input translation unit.
 		 *
@@ -216,6 +222,7 @@ namespace conversion {
 		std::shared_ptr<state::FunctionManager> getFunMan() const { return funManPtr; }
 		std::shared_ptr<state::RecordManager> getRecordMan() const { return recordManPtr; }
 		std::shared_ptr<utils::HeaderTagger> getHeaderTagger() const { return headerTaggerPtr; }
+		std::map<std::string, std::vector<const clang::TagDecl*>>& getInstantiationNameMapping() const { return instantiationNameMapping; }
 
 		const pragma::PragmaStmtMap& getPragmaMap() const {	return pragmaMap; }
 
@@ -39,6 +39,7 @@
 
 #include <vector>
 #include <functional>
+#include <mutex>
 
 #include "insieme/core/ir_node.h"
 
@@ -57,6 +58,9 @@ namespace extensions {
 	  private:
 		vector<insieme::core::NodePtr> entryPoints;
 
+		// guards the entry point list, which is filled by concurrently converted translation units
+		std::mutex entryPointsLock;
+
 	  public:
 		/**
 		 * Registers all "insieme" pragmas and their handlers
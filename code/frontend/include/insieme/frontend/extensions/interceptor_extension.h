@@ -37,6 +37,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "insieme/frontend/extensions/frontend_extension.h"
 #include "insieme/frontend/clang.h"
 #include "insieme/frontend/converter.h"
@@ -52,6 +54,9 @@ namespace extensions {
 	  private:
 		SpecializationMap templateSpecializationMapping;
 
+		// guards the specialization map, which is shared by concurrently converted translation units
+		std::mutex templateSpecializationMappingLock;
+
 	  public:
 		InterceptorExtension();
 
@@ -37,6 +37,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "insieme/frontend/extensions/frontend_extension.h"
 
 
@@ -54,6 +56,7 @@ namespace extensions {
 
 	class OmpFrontendExtension : public FrontendExtension {
 		std::list<core::ExpressionPtr> thread_privates;
+		std::mutex thread_privates_lock;
 		bool flagActivated;
 
 	  public:
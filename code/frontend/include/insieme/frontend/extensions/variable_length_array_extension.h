@@ -39,6 +39,7 @@
 
 #include <list>
 #include <map>
+#include <mutex>
 
 #include "insieme/frontend/extensions/frontend_extension.h"
 
@@ -53,12 +54,22 @@ namespace extensions {
 	
 	class VariableLengthArrayExtension : public FrontendExtension {
 	private:
-		// store list of generated declaration expressions
-		std::list<core::DeclarationStmtPtr> sizes;
-		// map from clang declarations to the associated variable array type
-		std::map<const clang::VariableArrayType*, core::TypePtr> arrayTypeMap;
-		// whether we are currently in a declaration statement
-		bool inDecl = false;
+		// the state maintained while converting a translation unit
+		struct ConversionState {
+			// store list of generated declaration expressions
+			std::list<core::DeclarationStmtPtr> sizes;
+			// map from clang declarations to the associated variable array type
+			std::map<const clang::VariableArrayType*, core::TypePtr> arrayTypeMap;
+			// whether we are currently in a declaration statement
+			bool inDecl = false;
+		};
+
+		// the states of the (potentially concurrent) conversions utilizing this extension
+		std::map<const conversion::Converter*, ConversionState> states;
+		std::mutex statesLock;
+
+		// obtains the state of the conversion conducted by the given converter
+		ConversionState& getState(const conversion::Converter& converter);
 
 	public:
 		/**
@@ -37,6 +37,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
@@ -51,6 +52,7 @@
 #include "insieme/core/ir_program.h"
 
 #include "insieme/core/tu/ir_translation_unit.h"
+#include "insieme/core/tu/ir_translation_unit_io.h"
 #include "insieme/frontend/extensions/frontend_extension.h"
 #include "insieme/frontend/extensions/frontend_cleanup_extension.h"
 
@@ -150,6 +152,11 @@ namespace frontend {
 		 */
 		unsigned flags;
 
+		/**
+		 * The number of threads to be used for converting translation units concurrently.
+		 */
+		unsigned numThreads;
+
 	  protected:
 		/**
 		 *  A list that contains all user extensions that have been registered
@@ -196,6 +203,21 @@ namespace frontend {
 			flags = options;
 		}
 
+		/**
+		 * Obtains the number of threads to be used for converting translation units.
+		 */
+		unsigned getNumThreads() const {
+			return numThreads;
+		}
+
+		/**
+		 * Updates the number of threads to be used for converting translation units. Each
+		 * file is converted on its own thread, using a node manager of its own.
+		 */
+		void setNumThreads(unsigned numThreads) {
+			this->numThreads = std::max(numThreads, 1u);
+		}
+
 		/**
 		 * Obtains the standard to be used for parsing input files.
 		 */
@@ -387,6 +409,11 @@ namespace frontend {
 		 */
 		vector<core::tu::IRTranslationUnit> libs;
 
+		/**
+		 * Extra libraries to be considered for the conversion, whose definitions are only loaded when being used.
+		 */
+		vector<core::tu::LazyIRTranslationUnit> lazyLibs;
+
 		/**
 		 * A vector of pairs. Each pair contains a frontend extension pointer and a
 		 * lambda that was retrieved from the extension. This lambda will decide
@@ -478,6 +505,20 @@ namespace frontend {
 			libs.push_back(unit);
 		}
 
+		/**
+		 * Obtains a reference to the lazily loaded libs to be considered by this conversion job.
+		 */
+		const vector<core::tu::LazyIRTranslationUnit>& getLazyLibs() const {
+			return lazyLibs;
+		}
+
+		/**
+		 * Sets the lazily loaded libs to be considered by this conversion job.
+		 */
+		void setLazyLibs(const vector<core::tu::LazyIRTranslationUnit>& lazyLibs) {
+			this->lazyLibs = lazyLibs;
+		}
+
 		/**
 		 * Determines whether this conversion job is processing a C++ file or not.
 		 */
@@ -609,6 +650,13 @@ namespace frontend {
 
 	  private:
 
+		/**
+		 * An internal utility converting the files of this job concurrently. Each file is converted
+		 * using its own node manager extending the given one. Those managers are added to the given
+		 * list and have to be kept alive as long as the resulting translation units are in use.
+		 */
+		vector<core::tu::IRTranslationUnit> convertConcurrently(core::NodeManager& manager, vector<std::unique_ptr<core::NodeManager>>& managers);
+
 		/**
 		 * An internal utility applying post-processing steps to the generated program.
 		 */
@@ -35,9 +35,13 @@
  * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
  */
 
+#include <fstream>
 #include <functional>
+#include <sstream>
 
+#include <boost/filesystem.hpp>
 #include <boost/format.hpp>
+#include <boost/optional.hpp>
 
 #include "insieme/frontend/converter.h"
 
@@ -60,6 +64,7 @@
 #include "insieme/frontend/utils/source_locations.h"
 
 #include "insieme/utils/container_utils.h"
+#include "insieme/utils/disk_cache.h"
 #include "insieme/utils/numeric_cast.h"
 #include "insieme/utils/logging.h"
 #include "insieme/utils/map_utils.h"
@@ -68,6 +73,7 @@
 #include "insieme/utils/assert.h"
 #include "insieme/utils/functional_utils.h"
 #include "insieme/utils/name_mangling.h"
+#include "insieme/utils/version.h"
 
 #include "insieme/core/analysis/ir_utils.h"
 #include "insieme/core/annotations/naming.h"
@@ -83,6 +89,7 @@
 #include "insieme/core/transform/manipulation.h"
 #include "insieme/core/transform/manipulation_utils.h"
 #include "insieme/core/transform/node_replacer.h"
+#include "insieme/core/tu/ir_translation_unit_io.h"
 #include "insieme/core/types/subtyping.h"
 
 #include "insieme/annotations/c/include.h"
@@ -94,13 +101,109 @@ using namespace insieme;
 
 namespace insieme {
 namespace frontend {
+
+	namespace {
+
+		boost::optional<std::string> readFile(const path& file) {
+			std::ifstream in(file.string(), std::ios::in | std::ios::binary);
+			if(!in) { return boost::none; }
+			std::stringstream buffer;
+			buffer << in.rdbuf();
+			return buffer.str();
+		}
+
+		/**
+		 * Computes the key of the cache entry of the given input file, covering everything influencing
+		 * the conversion except for the included headers, which are validated when looking up the entry.
+		 */
+		boost::optional<std::string> getCacheKey(const path& unit, const ConversionSetup& setup) {
+			auto content = readFile(unit);
+			if(!content) { return boost::none; }
+
+			std::stringstream key;
+			key << "frontend\n" << insieme::utils::getVersion() << "\n";
+			key << "std:" << setup.getStandard() << "\n";
+			for(auto option : {ConversionSetup::PrintDiag, ConversionSetup::NoWarnings, ConversionSetup::NoDefaultExtensions, ConversionSetup::NoColor}) {
+				key << "option:" << setup.hasOption(option) << "\n";
+			}
+			for(const auto& cur : setup.getIncludeDirectories()) { key << "I:" << cur.string() << "\n"; }
+			for(const auto& cur : setup.getSystemHeadersDirectories()) { key << "S:" << cur.string() << "\n"; }
+			for(const auto& cur : setup.getInterceptedHeaderDirs()) { key << "H:" << cur.string() << "\n"; }
+			for(const auto& cur : setup.getInterceptionWhitelist()) { key << "W:" << cur << "\n"; }
+			for(const auto& cur : setup.getDefinitions()) { key << "D:" << cur.first << "=" << cur.second << "\n"; }
+			for(const auto& cur : setup.getFFlags()) { key << "f:" << cur << "\n"; }
+			for(const auto& cur : setup.getExtensions()) {
+				const auto& ext = *cur;
+				key << "ext:" << typeid(ext).name() << "\n";
+			}
+			key << "file:" << boost::filesystem::absolute(unit).string() << "\n";
+			key << "content:" << insieme::utils::cache::DiskCache::getDigest(*content) << "\n";
+			return key.str();
+		}
+
+		/**
+		 * Reads the list of files a cache entry depends on, leaving the stream positioned at the dumped
+		 * translation unit. The entry is only valid if all the files it depends on are unchanged.
+		 */
+		bool checkDependencies(std::istream& in) {
+			std::size_t numDeps;
+			if(!(in >> numDeps)) { return false; }
+			in.ignore(1);
+			for(std::size_t i = 0; i < numDeps; i++) {
+				std::string file, digest;
+				if(!std::getline(in, file) || !std::getline(in, digest)) { return false; }
+				auto content = readFile(file);
+				if(!content || insieme::utils::cache::DiskCache::getDigest(*content) != digest) { return false; }
+			}
+			return true;
+		}
+	}
+
 	// ----------- conversion -----------
 	core::tu::IRTranslationUnit convert(core::NodeManager& manager, const path& unit, const ConversionSetup& setup) {
+		// check the cache for a result of a previous conversion
+		auto cache = insieme::utils::cache::DiskCache::getDefault();
+		boost::optional<std::string> key;
+		if(cache && !setup.hasOption(ConversionSetup::DumpClangAST)) { key = getCacheKey(unit, setup); }
+		if(key) {
+			std::streamoff start = 0;
+			auto entry = cache->lookup(*key, [&](const std::string& value) {
+				std::stringstream in(value);
+				if(!checkDependencies(in)) { return false; }
+				start = in.tellg();
+				return true;
+			});
+			if(entry) {
+				std::stringstream in(*entry, std::ios_base::in | std::ios_base::binary);
+				in.seekg(start);
+				return core::tu::load(in, manager);
+			}
+		}
+
 		// just delegate operation to converter
 		TranslationUnit tu(manager, unit, setup);
 		conversion::Converter c(manager, tu, setup);
 		// add them and fire the conversion
-		return c.convert();
+		auto res = c.convert();
+
+		// store the result along with the list of all files read while parsing
+		if(key) {
+			std::vector<std::pair<std::string, std::string>> deps;
+			const auto& sourceManager = c.getSourceManager();
+			for(auto it = sourceManager.fileinfo_begin(); it != sourceManager.fileinfo_end(); ++it) {
+				std::string file = it->first->getName();
+				auto content = readFile(file);
+				if(!content) { return res; } // not a plain file - no caching
+				deps.push_back({file, insieme::utils::cache::DiskCache::getDigest(*content)});
+			}
+			std::stringstream out(std::ios_base::out | std::ios_base::in | std::ios_base::binary);
+			out << deps.size() << "\n";
+			for(const auto& cur : deps) { out << cur.first << "\n" << cur.second << "\n"; }
+			core::tu::dump(out, res);
+			cache->store(*key, out.str());
+		}
+
+		return res;
 	}
 }
 }
@@ -37,8 +37,10 @@
 
 #include "insieme/frontend/extensions/insieme_pragma_extension.h"
 
+#include <algorithm>
 #include <iostream>
 #include <functional>
+#include <iterator>
 
 #include "insieme/annotations/data_annotations.h"
 #include "insieme/annotations/loop_annotations.h"
@@ -108,8 +110,17 @@ namespace extensions {
 	}
 
 	core::tu::IRTranslationUnit InsiemePragmaExtension::IRVisit(core::tu::IRTranslationUnit& tu) {
+		// collect the entry points marked within the given unit (units converted concurrently are using their own managers)
+		vector<insieme::core::NodePtr> localEntryPoints;
+		{
+			std::lock_guard<std::mutex> guard(entryPointsLock);
+			auto isLocal = [&](const NodePtr& cur) { return &cur->getNodeManager() == &tu.getNodeManager(); };
+			std::copy_if(entryPoints.begin(), entryPoints.end(), std::back_inserter(localEntryPoints), isLocal);
+			entryPoints.erase(std::remove_if(entryPoints.begin(), entryPoints.end(), isLocal), entryPoints.end());
+		}
+
 		// if there are no previously marked entry points, there's nothing to be done
-		if(entryPoints.size() < 1) { return tu; }
+		if(localEntryPoints.size() < 1) { return tu; }
 
 		// get IR for checking whether nodes are still valid
 		core::ExpressionPtr&& singlenode = core::tu::toIR(tu.getNodeManager(), tu);
@@ -117,7 +128,7 @@ namespace extensions {
 		IRBuilder builder(singlenode->getNodeManager());
 
 		// check if nodes previously marked as entry points are still valid and add them
-		for(auto it = entryPoints.begin(); it != entryPoints.end(); ++it) {
+		for(auto it = localEntryPoints.begin(); it != localEntryPoints.end(); ++it) {
 			visitBreadthFirstInterruptible(singlenode, [&](const NodePtr& node) {
 				ExpressionPtr expr = dynamic_pointer_cast<core::ExpressionPtr>(node);
 
@@ -139,7 +150,6 @@ namespace extensions {
 				return true;
 			});
 		}
-		entryPoints.clear();
 
 		return tu;
 	}
@@ -156,6 +166,7 @@ namespace extensions {
 			    LambdaExprPtr expr = dynamic_pointer_cast<const LambdaExpr>(nodes.front());
 			    assert_true(expr) << "Insieme mark pragma can only be attached to function declarations!";
 
+			    std::lock_guard<std::mutex> guard(entryPointsLock);
 			    entryPoints.push_back(expr);
 
 			    return nodes;
@@ -472,6 +472,7 @@ namespace extensions {
 			auto spec = injected->getInjectedSpecializationType()->getUnqualifiedDesugaredType();
 			if(auto tempSpecType = llvm::dyn_cast<clang::TemplateSpecializationType>(spec)) {
 				auto key = tempSpecType->getCanonicalTypeUnqualified().getTypePtr();
+				std::lock_guard<std::mutex> guard(templateSpecializationMappingLock);
 				if(!::containsKey(templateSpecializationMapping, key)) {
 					key->dump();
 					assert_fail() << "Template injected specialization type encountered, but no mapping available. Key ^^";
@@ -482,6 +483,7 @@ namespace extensions {
 
 		// lookup TemplateSpecializationTypes
 		if(auto tempSpecType = llvm::dyn_cast<clang::TemplateSpecializationType>(type->getCanonicalTypeUnqualified())) {
+			std::lock_guard<std::mutex> guard(templateSpecializationMappingLock);
 			if(::containsKey(templateSpecializationMapping, tempSpecType)) return templateSpecializationMapping[tempSpecType];
 		}
 
@@ -532,7 +534,10 @@ namespace extensions {
 							llvm::dyn_cast<clang::TemplateSpecializationType>(genericDecl->getInjectedClassNameSpecialization()->getUnqualifiedDesugaredType());
 					}
 					assert_false(tempSpecType == nullptr) << "Unexpected kind of template specialization\n";
-					templateSpecializationMapping[tempSpecType->getCanonicalTypeUnqualified().getTypePtr()] = genericGenType;
+					{
+						std::lock_guard<std::mutex> guard(templateSpecializationMappingLock);
+						templateSpecializationMapping[tempSpecType->getCanonicalTypeUnqualified().getTypePtr()] = genericGenType;
+					}
 
 					// build concrete genType
 					core::TypeList concreteTypeArguments;
@@ -697,6 +697,7 @@ namespace extensions {
 		    "omp", "threadprivate", threadprivate_clause >> tok::eod, [&](const MatchObject& object, core::NodeList nodes) {
 			    // store the name of the variables
 			    omp::VarListPtr tp = handleIdentifierList(object, "thread_private");
+			    std::lock_guard<std::mutex> guard(thread_privates_lock);
 			    for(unsigned i = 0; i < tp->size(); i++) {
 				    thread_privates.push_back(tp->at(i));
 			    }
@@ -48,10 +48,19 @@ namespace insieme {
 namespace frontend {
 namespace extensions {
 
+	VariableLengthArrayExtension::ConversionState& VariableLengthArrayExtension::getState(const conversion::Converter& converter) {
+		std::lock_guard<std::mutex> guard(statesLock);
+		return states[&converter];
+	}
+
 	insieme::core::TypePtr VariableLengthArrayExtension::Visit(const clang::QualType& type, insieme::frontend::conversion::Converter& converter) {
 		// we iterate trough the dimensions of the array from left to right. There is no hint
 		// in the C standard how this should be handled and therefore the normal operator precedence is used.
 		if(const clang::VariableArrayType* arrType = llvm::dyn_cast<clang::VariableArrayType>(type.getTypePtr())) {
+			auto& state = getState(converter);
+			auto& arrayTypeMap = state.arrayTypeMap;
+			auto& sizes = state.sizes;
+
 			// check if we already converted this decl
 			if(::containsKey(arrayTypeMap, arrType)) return arrayTypeMap[arrType];
 
@@ -76,13 +85,15 @@ namespace extensions {
 	}
 
 	stmtutils::StmtWrapper VariableLengthArrayExtension::Visit(const clang::Stmt* stmt, insieme::frontend::conversion::Converter& converter) {
-		if(llvm::dyn_cast<clang::DeclStmt>(stmt)) inDecl = true;
+		if(llvm::dyn_cast<clang::DeclStmt>(stmt)) getState(converter).inDecl = true;
 		return stmtutils::StmtWrapper();
 	}
 
 	stmtutils::StmtWrapper VariableLengthArrayExtension::PostVisit(const clang::Stmt* stmt, const stmtutils::StmtWrapper& irStmt,
 		                                                           insieme::frontend::conversion::Converter& converter) {
-		if(inDecl && sizes.size() > 0) {
+		auto& state = getState(converter);
+		auto& sizes = state.sizes;
+		if(state.inDecl && sizes.size() > 0) {
 			// insert the variable declarations of the indices before the array is declared
 			stmtutils::StmtWrapper newIRStmt = irStmt;
 			while(sizes.size() > 0) {
@@ -92,7 +103,7 @@ namespace extensions {
 			return newIRStmt;
 		}
 		assert_true(sizes.empty()) << "Sizes array not empty, something went wrong during translation of VLA type.";
-		inDecl = false;
+		state.inDecl = false;
 		return irStmt;
 	}
 
@@ -107,6 +118,7 @@ namespace extensions {
 			if(sizeofexpr->isArgumentType()) {
 				// run through the conversion to see if it's VLA
 				auto irType = converter.convertType(sizeofexpr->getTypeOfArgument());
+				auto& sizes = getState(converter).sizes;
 				// if sizes is not empty, we just converted a VLA
 				if(!sizes.empty()) {
 					// use sizes to navigate to innermost VLA and get its element type
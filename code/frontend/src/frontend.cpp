@@ -35,7 +35,9 @@
  * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
  */
 
+#include <atomic>
 #include <sstream>
+#include <thread>
 
 #include "insieme/frontend/frontend.h"
 
@@ -49,6 +51,7 @@
 
 #include "insieme/common/env_vars.h"
 
+#include "insieme/core/ir_builder.h"
 #include "insieme/core/ir_statistic.h"
 #include "insieme/core/annotations/naming.h"
 #include "insieme/core/transform/manipulation_utils.h"
@@ -78,7 +81,7 @@ namespace frontend {
 	const unsigned ConversionSetup::DEFAULT_FLAGS = PrintDiag;
 
 	ConversionSetup::ConversionSetup(const vector<path>& includeDirs)
-	    : includeDirs(includeDirs), standard(Auto), definitions(), interceptedHeaderDirs(), flags(DEFAULT_FLAGS){};
+	    : includeDirs(includeDirs), standard(Auto), definitions(), interceptedHeaderDirs(), flags(DEFAULT_FLAGS), numThreads(1){};
 
 
 	bool ConversionSetup::isCxx(const path& file) const {
@@ -159,26 +162,76 @@ namespace frontend {
 		// extension initialization
 		frontendExtensionInit();
 
+		// the managers of concurrently converted files, they have to outlive the merge step
+		vector<std::unique_ptr<core::NodeManager>> localManagers;
+
 		// convert files to translation units
-		auto units = ::transform(files, [&](const path& file) -> core::tu::IRTranslationUnit {
-			auto res = convert(manager, file, *this);
+		vector<core::tu::IRTranslationUnit> units;
+		if(getNumThreads() > 1 && files.size() > 1) {
+			units = convertConcurrently(manager, localManagers);
+
+			// maybe a visitor wants to manipulate the IR program (in the order of the files, to be deterministic)
+			for(auto& res : units) {
+				for(auto extension : getExtensions())
+					res = extension->IRVisit(res);
+			}
+		} else {
+			units = ::transform(files, [&](const path& file) -> core::tu::IRTranslationUnit {
+				auto res = convert(manager, file, *this);
 
-			// maybe a visitor wants to manipulate the IR program
-			for(auto extension : getExtensions())
-				res = extension->IRVisit(res);
+				// maybe a visitor wants to manipulate the IR program
+				for(auto extension : getExtensions())
+					res = extension->IRVisit(res);
 
-			// done
-			return res;
-		});
+				// done
+				return res;
+			});
+		}
 
 		// merge the translation units
-		auto singleTu = core::tu::merge(manager, core::tu::merge(manager, libs), core::tu::merge(manager, units));
+		auto singleTu = core::tu::merge(manager, core::tu::merge(manager, libs), core::tu::merge(manager, units, getNumThreads()));
+
+		// link lazily loaded libraries, restoring only the definitions actually used
+		if(!lazyLibs.empty()) { singleTu = core::tu::link(manager, singleTu, lazyLibs); }
 
 		// forward the C++ flag
 		singleTu.setCXX(this->isCxx());
 		return singleTu;
 	}
 
+	vector<core::tu::IRTranslationUnit> ConversionJob::convertConcurrently(core::NodeManager& manager,
+	                                                                        vector<std::unique_ptr<core::NodeManager>>& managers) {
+		// lazily created language constructs of the shared manager have to be present before going concurrent
+		auto& basic = manager.getLangBasic();
+		core::IRBuilder(manager).parseType("int<4>");
+		basic.getDirectSuperTypesOf(basic.getInt4());
+
+		// every file gets a manager of its own, extending the shared one
+		for(unsigned i = 0; i < files.size(); ++i) {
+			managers.push_back(std::unique_ptr<core::NodeManager>(new core::NodeManager(manager)));
+		}
+
+		// a worker converting files until there are none left
+		vector<core::tu::IRTranslationUnit> units(files.size(), core::tu::IRTranslationUnit(manager));
+		std::atomic<unsigned> nextFile(0);
+		auto worker = [&]() {
+			for(unsigned i = nextFile++; i < files.size(); i = nextFile++) {
+				units[i] = convert(*managers[i], files[i], *this);
+			}
+		};
+
+		vector<std::thread> threads;
+		for(unsigned i = 1; i < std::min<std::size_t>(getNumThreads(), files.size()); ++i) {
+			threads.emplace_back(worker);
+		}
+		worker();
+		for(auto& cur : threads) {
+			cur.join();
+		}
+
+		return units;
+	}
+
 	core::ProgramPtr ConversionJob::applyPostProcessing(core::NodeManager& manager, core::ProgramPtr& program) const {
 		// strip of OMP annotation since those may contain references to local nodes
 		core::visitDepthFirstOnce(program, [](const core::NodePtr& cur) { cur->remAnnotation(omp::BaseAnnotation::KEY); });
@@ -241,7 +294,8 @@ namespace frontend {
 	bool ConversionJob::isCxx() const {
 		bool cppFile = any(files, [&](const path& cur) { return ConversionSetup::isCxx(cur); });
 
-		bool cppLibs = any(libs, [](const core::tu::IRTranslationUnit& tu) { return tu.isCXX(); });
+		bool cppLibs = any(libs, [](const core::tu::IRTranslationUnit& tu) { return tu.isCXX(); })
+		               || any(lazyLibs, [](const core::tu::LazyIRTranslationUnit& tu) { return tu.getBase().isCXX(); });
 
 		return cppFile || cppLibs;
 	}
@@ -287,10 +341,12 @@ namespace frontend {
 		    << "PrintDiag " << hasOption(ConversionSetup::PrintDiag) << "\n"
 		    << "NoWarnings " << hasOption(ConversionSetup::NoWarnings) << "\n"
 		    << "NoDefaultExtensions " << hasOption(ConversionSetup::NoDefaultExtensions) << "\n" << std::endl;
+		out << "threads: \n" << getNumThreads() << std::endl;
 		out << "interceptions: \n" << getInterceptedHeaderDirs() << std::endl;
 		out << "include dirs: \n" << getIncludeDirectories() << std::endl;
 		out << "definitions: \n" << getDefinitions() << std::endl;
 		out << "libraries: \n" << libs << std::endl;
+		out << "lazily loaded libraries: \n" << lazyLibs.size() << std::endl;
 		out << "standard: \n" << getStandard() << std::endl;
 		out << "number of registered extensions: \n" << getExtensions().size() << std::endl;
 		out << "~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
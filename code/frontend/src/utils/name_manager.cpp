@@ -287,7 +287,7 @@ namespace utils {
 	}
 
 	std::pair<std::string,bool> getNameForTagDecl(const conversion::Converter& converter, const clang::TagDecl* tagDecl, bool cStyleName) {
-		static std::map<std::string, std::vector<const clang::TagDecl*>> instantiationNameMapping;
+		auto& instantiationNameMapping = converter.getInstantiationNameMapping();
 
 		auto canon = tagDecl->getCanonicalDecl();
 		// try to use name, if not available try to use typedef name, otherwise no name
@@ -52,11 +52,14 @@ struct _irt_client_app {
 	irt_client_app_id id;
 	size_t pid;
 	void* library;
+	uint32 weight; // share of the worker pool relative to the other applications of a runtime service
+	void (*init_context)(irt_context* context);
+	void (*cleanup_context)(irt_context* context);
 };
 
 /* ------------------------------ operations ----- */
 
-irt_client_app* irt_client_app_create(const char* library_file_name);
+irt_client_app* irt_client_app_create(const char* library_file_name, uint32 weight);
 void irt_client_app_destroy(irt_client_app* app);
 
 
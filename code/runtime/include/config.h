@@ -66,6 +66,18 @@
 // workers must not sleep when compiling/running a program on windows xp because condition variables are not supported there
 //#define IRT_WORKER_SLEEPING
 
+// degree of parallelism control
+#define IRT_DOP_CONTROL_ENV "IRT_DOP_CONTROL"
+#define IRT_DOP_CONTROL_MIN_ENV "IRT_DOP_CONTROL_MIN"
+#define IRT_DOP_CONTROL_MAX_ENV "IRT_DOP_CONTROL_MAX"
+// the controller runs on the maintenance thread, which is only available with region instrumentation
+#if defined IRT_ENABLE_REGION_INSTRUMENTATION && !defined _GEMS
+#define IRT_DOP_CONTROL_AVAILABLE
+#endif
+#ifndef IRT_DOP_CONTROL_INTERVAL_DEFAULT_MS
+#define IRT_DOP_CONTROL_INTERVAL_DEFAULT_MS 100
+#endif
+
 // ir interface
 #ifndef IRT_SANE_PARALLEL_MAX
 #define IRT_SANE_PARALLEL_MAX 2048
@@ -108,7 +120,14 @@
 #define IRT_REPORT_TO_FILE_ENV "IRT_REPORT_TO_FILE"
 
 // for using a minimal variant of the runtime without affinity and message queues => standalone mode only
+// the runtime service (src/runtime.c) is built with IRT_SERVICE_MODE, which keeps the message queue support
+#ifndef IRT_SERVICE_MODE
 #define IRT_MIN_MODE
+#endif
+
+// service mode: client applications sharing one worker pool
+#define IRT_MAX_TENANTS 64
+#define IRT_TENANT_DEFAULT_WEIGHT 1
 
 // define IRT_USE_PTHREADS if you want to use pthread lib for windows (has no effect under linux)
 // better pass it in as as flag for the compiler
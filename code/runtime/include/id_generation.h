@@ -87,6 +87,16 @@ typedef enum {
 		id.cached = NULL;                                                                                                                                      \
 		return id;                                                                                                                                             \
 	}                                                                                                                                                          \
+	/* reserves count consecutive ids in one go, the first of which is returned */                                                                             \
+	static inline irt_##__type##_id irt_generate_##__type##_id_range(void* generator_id_ptr, uint32 count) {                                                   \
+		irt_##__type##_id id;                                                                                                                                  \
+		irt_##__type##_id* gen_id = (irt_##__type##_id*)generator_id_ptr;                                                                                      \
+		id.full = gen_id->full;                                                                                                                                \
+		gen_id->index += count;                                                                                                                                \
+		id.id_type = IRT_ID_##__type;                                                                                                                          \
+		id.cached = NULL;                                                                                                                                      \
+		return id;                                                                                                                                             \
+	}                                                                                                                                                          \
 	static inline irt_##__type##_id irt_##__type##_null_id() {                                                                                                 \
 		irt_##__type##_id null_id = {{0}, NULL};                                                                                                               \
 		/* Note: not setting the id_type here, since the null_id is generic for any id */                                                                      \
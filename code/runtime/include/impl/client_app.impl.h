@@ -47,16 +47,17 @@
 
 #ifndef IRT_MIN_MODE
 
-irt_client_app* irt_client_app_create(const char* library_file_name) {
+irt_client_app* irt_client_app_create(const char* library_file_name, uint32 weight) {
 	irt_client_app* app = (irt_client_app*)malloc(sizeof(irt_client_app));
 	#ifndef IRT_MIN_MODE
 	app->id = irt_generate_client_app_id(IRT_LOOKUP_GENERATOR_ID_PTR);
+	app->weight = weight > 0 ? weight : IRT_TENANT_DEFAULT_WEIGHT;
 	app->library = dlopen_unique(library_file_name, RTLD_NOW);
 	IRT_ASSERT(app->library != NULL, IRT_ERR_IO, "Could not load library %s\nError: %s\n", library_file_name, dlerror());
 
-	app->init_context = (init_context_fun*)dlsym(app->library, IRT_APP_INIT_CONTEXT_NAME);
+	app->init_context = (void (*)(irt_context*))dlsym(app->library, IRT_APP_INIT_CONTEXT_NAME);
 	IRT_ASSERT(app->init_context != NULL, IRT_ERR_APP, "Insieme init function not found in library %s\nError: %s\n", library_file_name, dlerror());
-	app->cleanup_context = (cleanup_context_fun*)dlsym(app->library, IRT_APP_CLEANUP_CONTEXT_NAME);
+	app->cleanup_context = (void (*)(irt_context*))dlsym(app->library, IRT_APP_CLEANUP_CONTEXT_NAME);
 	IRT_ASSERT(app->cleanup_context != NULL, IRT_ERR_APP, "Insieme cleanup function not found in library %s\nError: %s\n", library_file_name, dlerror());
 	#endif
 	return app;
@@ -56,6 +56,7 @@
 #include "utils/memory.h"
 #include "impl/error_handling.impl.h"
 #include "instrumentation_regions_includes.h"
+#include "irt_dop_control.h"
 
 // --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 //
@@ -292,6 +293,7 @@ void irt_inst_region_init(irt_context* context) {
 	}
 	_irt_inst_region_metrics_init(context);
 	irt_inst_region_select_metrics_from_env();
+	irt_dop_control_attach_context(context);
 }
 
 void irt_inst_region_init_worker(irt_worker* worker) {
@@ -299,6 +301,7 @@ void irt_inst_region_init_worker(irt_worker* worker) {
 }
 
 void irt_inst_region_finalize(irt_context* context) {
+	irt_dop_control_detach_context(context);
 	_irt_inst_region_metrics_finalize(context);
 	irt_time_ticks_per_sec_calibration_mark(); // needs to be done before any time instrumentation processing!
 	irt_inst_region_output();
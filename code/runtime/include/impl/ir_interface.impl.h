@@ -118,8 +118,7 @@ void irt_pfor(irt_work_item* self, irt_work_group* group, irt_work_item_range ra
 
 irt_joinable irt_parallel(const irt_parallel_job* job) {
 	// Parallel
-	// TODO: make optional, better scheduling,
-	// speedup using custom implementation without adding each item individually to group
+	// TODO: make optional, better scheduling
 	#ifdef IRT_ENABLE_OMPP_OPTIMIZER_DCT
 	// Note: We use the first implementation here since it may carry optimization data
 	// Note: this call and the call of irt_optimizer_set_wrapping_optimizations below maybe should be moved further down just before WI assignment
@@ -128,10 +127,14 @@ irt_joinable irt_parallel(const irt_parallel_job* job) {
 	irt_work_group* retwg = irt_wg_create();
 	irt_joinable ret;
 	ret.wg_id = retwg->id;
+	// restrict the team to the workers assigned to the current context
+	uint32 first_worker, num_workers;
+	irt_context_get_worker_share(irt_worker_get_current()->cur_context, &first_worker, &num_workers);
+	uint32 span = num_workers < irt_g_degree_of_parallelism ? num_workers : irt_g_degree_of_parallelism;
 	uint32 num_threads = (job->max / 2 + job->min / 2);
 	num_threads -= num_threads % job->mod;
 	if(job->max >= IRT_SANE_PARALLEL_MAX) {
-		num_threads = irt_g_degree_of_parallelism;
+		num_threads = span;
 		irt_work_item* cur_wi = irt_wi_get_current();
 		if(cur_wi && cur_wi->default_parallel_wi_count != 0) { num_threads = cur_wi->default_parallel_wi_count; }
 	}
@@ -143,12 +146,12 @@ irt_joinable irt_parallel(const irt_parallel_job* job) {
 	irt_atomic_add_and_fetch(&irt_g_app_progress, num_threads, uint64);
 	#endif // IRT_ENABLE_APP_TIME_ACCOUNTING
 	irt_work_item** wis = (irt_work_item**)alloca(sizeof(irt_work_item*) * num_threads);
+	irt_wi_create_batch(num_threads, irt_g_wi_range_one_elem, job->impl, job->args, wis);
+	irt_wg_insert_batch(retwg, num_threads, wis);
 	for(uint32 i = 0; i < num_threads; ++i) {
-		wis[i] = irt_wi_create(irt_g_wi_range_one_elem, job->impl, job->args);
-		irt_wg_insert(retwg, wis[i]);
-	}
-	for(uint32 i = 0; i < num_threads; ++i) {
-		irt_scheduling_generate_wi(irt_g_workers[i % irt_g_degree_of_parallelism], wis[i]);
+		uint32 target = first_worker + i % span;
+		if(target >= irt_g_degree_of_parallelism) { target %= irt_g_degree_of_parallelism; }
+		irt_scheduling_generate_wi(irt_g_workers[target], wis[i]);
 	}
 	#ifdef _GEMS_SIM
 	// alloca is implemented as malloc
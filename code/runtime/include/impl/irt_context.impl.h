@@ -63,6 +63,9 @@ irt_context* irt_context_create_standalone(init_context_fun* init_fun, cleanup_c
 	context->client_app = NULL;
 	context->init_fun = init_fun;
 	context->cleanup_fun = cleanup_fun;
+	context->weight = IRT_TENANT_DEFAULT_WEIGHT;
+	context->first_worker = 0;
+	context->num_workers = 0;
 	irt_context_table_insert(context);
 	return context;
 }
@@ -74,6 +77,9 @@ void irt_context_initialize(irt_context* context) {
 }
 
 irt_context* irt_context_create(irt_client_app* app, init_context_fun* init_fun, cleanup_context_fun* cleanup_fun) {
+	// fall back to the context functions exported by the client application library
+	if(app && !init_fun) { init_fun = app->init_context; }
+	if(app && !cleanup_fun) { cleanup_fun = app->cleanup_context; }
 	irt_context* context = irt_context_create_standalone(init_fun, cleanup_fun);
 	context->client_app = app;
 	irt_log_comment("starting new context");
@@ -97,5 +103,90 @@ void irt_context_destroy(irt_context* context) {
 	free(context);
 }
 
+static inline void irt_context_get_worker_share(irt_context_id context_id, uint32* first, uint32* count) {
+	irt_context* context = context_id.cached;
+	if(context == NULL || context->num_workers == 0) {
+		*first = 0;
+		*count = irt_g_worker_count;
+		return;
+	}
+	*first = context->first_worker;
+	*count = context->num_workers;
+}
+
+// distributes the workers among the registered tenants using the largest remainder method
+// requires irt_g_tenant_mutex to be held
+static inline void _irt_context_partition_workers() {
+	uint32 num_tenants = irt_g_tenant_count;
+	if(num_tenants == 0) {
+		for(uint32 w = 0; w < irt_g_worker_count; ++w) {
+			irt_g_workers[w]->share_first = 0;
+			irt_g_workers[w]->share_count = irt_g_worker_count;
+		}
+		return;
+	}
+	uint64 total_weight = 0;
+	for(uint32 i = 0; i < num_tenants; ++i) {
+		total_weight += irt_g_tenants[i]->weight;
+	}
+
+	uint32 shares[IRT_MAX_TENANTS];
+	uint64 remainders[IRT_MAX_TENANTS];
+	uint32 assigned = 0;
+	for(uint32 i = 0; i < num_tenants; ++i) {
+		uint64 scaled = (uint64)irt_g_worker_count * irt_g_tenants[i]->weight;
+		shares[i] = (uint32)(scaled / total_weight);
+		remainders[i] = scaled % total_weight;
+		assigned += shares[i];
+	}
+	// hand out the remaining workers to the tenants with the largest remainders
+	while(assigned < irt_g_worker_count) {
+		uint32 best = 0;
+		for(uint32 i = 1; i < num_tenants; ++i) {
+			if(remainders[i] > remainders[best]) { best = i; }
+		}
+		shares[best]++;
+		remainders[best] = 0;
+		assigned++;
+	}
+
+	// every tenant needs to make progress - with more tenants than workers, ranges wrap around and overlap
+	uint32 next = 0;
+	for(uint32 i = 0; i < num_tenants; ++i) {
+		irt_context* tenant = irt_g_tenants[i];
+		tenant->first_worker = next % irt_g_worker_count;
+		tenant->num_workers = shares[i] > 0 ? shares[i] : 1;
+		if(tenant->first_worker + tenant->num_workers > irt_g_worker_count) { tenant->first_worker = irt_g_worker_count - tenant->num_workers; }
+		next += tenant->num_workers;
+		for(uint32 w = tenant->first_worker; w < tenant->first_worker + tenant->num_workers; ++w) {
+			irt_g_workers[w]->share_first = tenant->first_worker;
+			irt_g_workers[w]->share_count = tenant->num_workers;
+		}
+		IRT_DEBUG("Tenant %u: weight %u, workers [%u, %u)\n", i, tenant->weight, tenant->first_worker, tenant->first_worker + tenant->num_workers);
+	}
+}
+
+void irt_context_add_tenant(irt_context* context, uint32 weight) {
+	irt_mutex_lock(&irt_g_tenant_mutex);
+	IRT_ASSERT(irt_g_tenant_count < IRT_MAX_TENANTS, IRT_ERR_OVERFLOW, "Exceeded maximum number of client applications (%d)", IRT_MAX_TENANTS);
+	context->weight = weight > 0 ? weight : IRT_TENANT_DEFAULT_WEIGHT;
+	irt_g_tenants[irt_g_tenant_count++] = context;
+	_irt_context_partition_workers();
+	irt_mutex_unlock(&irt_g_tenant_mutex);
+}
+
+void irt_context_remove_tenant(irt_context* context) {
+	irt_mutex_lock(&irt_g_tenant_mutex);
+	for(uint32 i = 0; i < irt_g_tenant_count; ++i) {
+		if(irt_g_tenants[i] == context) {
+			irt_g_tenants[i] = irt_g_tenants[--irt_g_tenant_count];
+			break;
+		}
+	}
+	context->num_workers = 0;
+	_irt_context_partition_workers();
+	irt_mutex_unlock(&irt_g_tenant_mutex);
+}
+
 
 #endif // ifndef __GUARD_IMPL_IRT_CONTEXT_IMPL_H
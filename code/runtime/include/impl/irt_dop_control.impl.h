@@ -0,0 +1,217 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#pragma once
+#ifndef __GUARD_IMPL_IRT_DOP_CONTROL_IMPL_H
+#define __GUARD_IMPL_IRT_DOP_CONTROL_IMPL_H
+
+#include "irt_dop_control.h"
+#include "irt_scheduling.h"
+#include "irt_logging.h"
+#include "worker.h"
+#include "utils/timing.h"
+
+#ifdef IRT_DOP_CONTROL_AVAILABLE
+#include "irt_maintenance.h"
+#endif
+
+static irt_dop_control_state irt_g_dop_control_state;
+static bool irt_g_dop_control_active = false;
+
+uint32 irt_dop_control_decide(irt_dop_control_state* state, uint64 interval_ns, uint64 idle_ns, uint64 region_executions) {
+	uint32 dop = state->cur_dop;
+	int64 next = dop;
+	double idle_fraction = (interval_ns > 0) ? idle_ns / ((double)interval_ns * dop) : 0.0;
+	double throughput = (interval_ns > 0) ? region_executions * 1e9 / interval_ns : 0.0;
+
+	if(idle_fraction > IRT_DOP_CONTROL_IDLE_THRESHOLD) {
+		// workers are starving, release one of them
+		next = dop - 1;
+	} else if(state->hold > 0) {
+		// a step was reverted recently
+		state->hold--;
+	} else if(region_executions == 0 || state->last_throughput <= 0.0) {
+		// no throughput information, but the active workers are busy
+		next = dop + 1;
+	} else if(state->last_dop != dop) {
+		// evaluate the previous step: continue if it paid off, otherwise revert it
+		double gain = throughput / state->last_throughput;
+		if(dop > state->last_dop && gain >= 1.0 + IRT_DOP_CONTROL_MIN_GAIN) {
+			next = dop + 1;
+		} else if(dop < state->last_dop && gain >= 1.0 - IRT_DOP_CONTROL_MIN_GAIN) {
+			// same throughput with fewer workers, e.g. in memory bound regions
+			next = dop - 1;
+		} else {
+			next = state->last_dop;
+			state->hold = IRT_DOP_CONTROL_HOLD_SAMPLES;
+		}
+	} else {
+		// stable for a while, probe whether conditions have changed
+		next = (dop < state->max_dop) ? dop + 1 : dop - 1;
+	}
+
+	if(next < state->min_dop) { next = state->min_dop; }
+	if(next > state->max_dop) { next = state->max_dop; }
+
+	state->last_dop = dop;
+	state->last_throughput = throughput;
+	state->cur_dop = (uint32)next;
+	return state->cur_dop;
+}
+
+#ifdef IRT_DOP_CONTROL_AVAILABLE
+
+static inline uint64 _irt_dop_control_get_idle_ticks() {
+	uint64 now = irt_time_ticks();
+	uint64 sum = 0;
+	for(uint32 i = 0; i < irt_g_worker_count; ++i) {
+		irt_worker* w = irt_g_workers[i];
+		uint64 since = w->idle_since;
+		sum += w->idle_ticks + ((since != 0 && since < now) ? now - since : 0);
+	}
+	return sum;
+}
+
+static inline uint64 _irt_dop_control_get_region_executions(irt_dop_control_state* state) {
+	uint64 sum = 0;
+	irt_spin_lock(&state->context_lock);
+	if(state->context) {
+		for(uint32 i = 0; i < state->context->num_regions; ++i) {
+			sum += state->context->inst_region_data[i].num_executions;
+		}
+	}
+	irt_spin_unlock(&state->context_lock);
+	return sum;
+}
+
+uint64 _irt_dop_control_maintenance_func(void* data) {
+	irt_dop_control_state* state = (irt_dop_control_state*)data;
+	if(!irt_g_dop_control_active) { return 0; }
+
+	uint64 now = irt_time_ns();
+	uint64 idle_ticks = _irt_dop_control_get_idle_ticks();
+	uint64 executions = _irt_dop_control_get_region_executions(state);
+	uint64 interval_ns = now - state->last_time_ns;
+	// idle time of workers which are being shut down by the scheduler may run backwards
+	uint64 idle_ns = (idle_ticks > state->last_idle_ticks) ? irt_time_convert_ticks_to_ns(idle_ticks - state->last_idle_ticks) : 0;
+	uint64 region_executions = (executions > state->last_executions) ? executions - state->last_executions : 0;
+	state->last_time_ns = now;
+	state->last_idle_ticks = idle_ticks;
+	state->last_executions = executions;
+
+	// the degree of parallelism may also have been changed externally, e.g. by the optimizer
+	state->cur_dop = irt_g_degree_of_parallelism;
+	uint32 prev = state->cur_dop;
+	uint32 next = irt_dop_control_decide(state, interval_ns, idle_ns, region_executions);
+	if(next != prev) { irt_scheduling_set_dop(next); }
+	return IRT_DOP_CONTROL_INTERVAL_DEFAULT_MS;
+}
+
+static irt_maintenance_lambda _irt_dop_control_maintenance_lambda = {&_irt_dop_control_maintenance_func, &irt_g_dop_control_state,
+                                                                     IRT_DOP_CONTROL_INTERVAL_DEFAULT_MS, NULL};
+
+static inline uint32 _irt_dop_control_get_env_limit(const char* name, uint32 def) {
+	char* str = getenv(name);
+	if(!str) { return def; }
+	int32 val = atoi(str);
+	if(val < 1) { val = 1; }
+	if((uint32)val > irt_g_worker_count) { val = irt_g_worker_count; }
+	return val;
+}
+
+void irt_dop_control_start() {
+	if(!irt_g_dop_control_active) { return; }
+
+	irt_dop_control_state* state = &irt_g_dop_control_state;
+	state->min_dop = _irt_dop_control_get_env_limit(IRT_DOP_CONTROL_MIN_ENV, 1);
+	state->max_dop = _irt_dop_control_get_env_limit(IRT_DOP_CONTROL_MAX_ENV, irt_g_worker_count);
+	IRT_ASSERT(state->min_dop <= state->max_dop, IRT_ERR_INIT, "Invalid degree of parallelism limits: %u > %u", state->min_dop, state->max_dop);
+	irt_log_setting_u(IRT_DOP_CONTROL_MIN_ENV, state->min_dop);
+	irt_log_setting_u(IRT_DOP_CONTROL_MAX_ENV, state->max_dop);
+
+	state->cur_dop = irt_g_degree_of_parallelism;
+	state->last_dop = state->cur_dop;
+	state->last_throughput = 0.0;
+	state->hold = 0;
+	state->last_time_ns = irt_time_ns();
+	state->last_idle_ticks = _irt_dop_control_get_idle_ticks();
+	state->last_executions = _irt_dop_control_get_region_executions(state);
+
+	// enforce the limits right from the start
+	if(state->cur_dop < state->min_dop || state->cur_dop > state->max_dop) {
+		state->cur_dop = (state->cur_dop < state->min_dop) ? state->min_dop : state->max_dop;
+		irt_scheduling_set_dop(state->cur_dop);
+	}
+
+	_irt_dop_control_maintenance_lambda.interval = IRT_DOP_CONTROL_INTERVAL_DEFAULT_MS;
+	irt_maintenance_register(&_irt_dop_control_maintenance_lambda);
+}
+
+#else // IRT_DOP_CONTROL_AVAILABLE
+
+void irt_dop_control_start() {
+	if(irt_g_dop_control_active) { IRT_WARN("%s set, but degree of parallelism control requires region instrumentation\n", IRT_DOP_CONTROL_ENV); }
+}
+
+#endif // IRT_DOP_CONTROL_AVAILABLE
+
+void irt_dop_control_init() {
+	irt_spin_init(&irt_g_dop_control_state.context_lock);
+	irt_g_dop_control_state.context = NULL;
+	irt_g_dop_control_active = getenv(IRT_DOP_CONTROL_ENV) != NULL;
+	irt_log_setting_s(IRT_DOP_CONTROL_ENV, irt_g_dop_control_active ? "enabled" : "disabled");
+}
+
+void irt_dop_control_cleanup() {
+	// the maintenance lambda unregisters itself on its next invocation
+	irt_g_dop_control_active = false;
+}
+
+void irt_dop_control_attach_context(irt_context* context) {
+	irt_spin_lock(&irt_g_dop_control_state.context_lock);
+	irt_g_dop_control_state.context = context;
+	irt_g_dop_control_state.last_executions = 0;
+	irt_spin_unlock(&irt_g_dop_control_state.context_lock);
+}
+
+void irt_dop_control_detach_context(irt_context* context) {
+	irt_spin_lock(&irt_g_dop_control_state.context_lock);
+	if(irt_g_dop_control_state.context == context) { irt_g_dop_control_state.context = NULL; }
+	irt_spin_unlock(&irt_g_dop_control_state.context_lock);
+}
+
+#endif // ifndef __GUARD_IMPL_IRT_DOP_CONTROL_IMPL_H
@@ -63,6 +63,11 @@ void irt_mqueue_init() {
 	}
 	IRT_ASSERT(irt_g_message_queue != -1, IRT_ERR_IO, "Could not open message queue %s.\nError string: %s\n", IRT_MQUEUE_NAME, strerror(errno));
 }
+void irt_mqueue_connect() {
+	irt_g_message_queue = mq_open(IRT_MQUEUE_NAME, O_WRONLY);
+	IRT_ASSERT(irt_g_message_queue != -1, IRT_ERR_IO, "Could not connect to message queue %s, is the runtime service running?\nError string: %s\n",
+	           IRT_MQUEUE_NAME, strerror(errno));
+}
 void irt_mqueue_cleanup() {
 	IRT_ASSERT(mq_unlink(IRT_MQUEUE_NAME) == 0, IRT_ERR_IO, "Could not unlink message queue " IRT_MQUEUE_NAME ".\n");
 }
@@ -81,10 +86,11 @@ irt_mqueue_msg* irt_mqueue_receive() {
 	return retval;
 }
 
-void irt_mqueue_send_new_app(const char* appname) {
+void irt_mqueue_send_new_app(const char* appname, uint32 weight) {
 	irt_mqueue_msg_new_app msg;
 	msg.type = IRT_MQ_NEW_APP;
 	msg.size = sizeof(irt_mqueue_msg_new_app);
+	msg.weight = weight;
 	memcpy(msg.app_name, appname, sizeof(msg.app_name));
 	msg.app_name[sizeof(msg.app_name) - 1] = '\0';
 	irt_mqueue_send((irt_mqueue_msg*)&msg);
@@ -93,6 +99,7 @@ void irt_mqueue_send_new_app(const char* appname) {
 #else
 
 void irt_mqueue_init() {}
+void irt_mqueue_connect() {}
 void irt_mqueue_cleanup() {}
 
 void irt_mqueue_send(const irt_mqueue_msg* msg) {}
@@ -100,7 +107,7 @@ irt_mqueue_msg* irt_mqueue_receive() {
 	return NULL;
 }
 
-void irt_mqueue_send_new_app(const char* appname) {}
+void irt_mqueue_send_new_app(const char* appname, uint32 weight) {}
 
 #endif
 
@@ -94,6 +94,8 @@ bool _irt_scheduling_sleep_if_dop_inactive(irt_worker* self) {
 		if(self->id.thread >= irt_g_degree_of_parallelism) {
 			irt_atomic_val_compare_and_swap(&self->state, IRT_WORKER_STATE_RUNNING, IRT_WORKER_STATE_DISABLED, uint32);
 			// TODO: migrate queued wis if not a stealing policy
+			// time spent disabled does not count as idle
+			irt_worker_idle_end(self);
 			// wait for signal
 			int wait_err = irt_cond_wait(&self->dop_wait_cond, &irt_g_degree_of_parallelism_mutex);
 			IRT_ASSERT(wait_err == 0, IRT_ERR_INTERNAL, "Worker failed to wait on scheduling condition");
@@ -128,6 +130,7 @@ void irt_scheduling_loop(irt_worker* self) {
 			#endif // IRT_ASTEROIDEA_STACKS
 			if(_irt_scheduling_sleep_if_dop_inactive(self)) { break; }
 		}
+		irt_worker_idle_begin(self);
 		_irt_scheduling_sleep_if_dop_inactive(self);
 		#ifdef IRT_WORKER_SLEEPING
 		irt_mutex_lock(&irt_g_active_worker_mutex);
@@ -119,6 +119,18 @@ void irt_wg_insert(irt_work_group* wg, irt_work_item* wi) {
 	wi->wg_memberships[group_num].pfor_count = 0;
 	// IRT_INFO("G: % 8lu Mem: % 3d  wi_id: % 8lu  g_n: % 3u\n", wg->id.full, mem_num, wi->id.full, group_num);
 }
+void irt_wg_insert_batch(irt_work_group* wg, uint32 count, irt_work_item** wis) {
+	uint32 mem_num = irt_atomic_fetch_and_add(&wg->local_member_count, count, uint32);
+	for(uint32 i = 0; i < count; ++i) {
+		irt_work_item* wi = wis[i];
+		if(wi->wg_memberships == NULL) { _irt_wi_allocate_wgs(wi); }
+		uint32 group_num = irt_atomic_fetch_and_add(&wi->num_groups, 1, uint32);
+		IRT_ASSERT(group_num < IRT_MAX_WORK_GROUPS, IRT_ERR_INTERNAL, "Some more changes required for a WI to be a member of multiple WGs");
+		wi->wg_memberships[group_num].wg_id = wg->id;
+		wi->wg_memberships[group_num].num = mem_num + i;
+		wi->wg_memberships[group_num].pfor_count = 0;
+	}
+}
 void irt_wg_remove(irt_work_group* wg, irt_work_item* wi) {
 	// TODO distributed
 	irt_atomic_dec(&wg->local_member_count, uint32);
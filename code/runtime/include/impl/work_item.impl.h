@@ -42,6 +42,7 @@
 #include "work_item.h"
 
 #include <stdlib.h>
+#include <stddef.h>
 #include "impl/worker.impl.h"
 #include "utils/impl/minlwt.impl.h"
 #include "abstraction/atomic.h"
@@ -105,8 +106,24 @@ static inline void _irt_print_work_item_range(const irt_work_item_range* r) {
 	IRT_INFO("%" PRId64 "..%" PRId64 " : %" PRId64, r->begin, r->end, r->step);
 }
 
-static inline void _irt_wi_init(irt_worker* self, irt_work_item* wi, const irt_work_item_range* range, irt_wi_implementation* impl, irt_lw_data_item* params) {
-	wi->id = irt_generate_work_item_id(IRT_LOOKUP_GENERATOR_ID_PTR);
+static inline irt_wi_param_block* irt_wi_param_block_create(irt_context* context, irt_lw_data_item* params) {
+	uint32 size = irt_type_get_bytes(context, params->type_id);
+	irt_wi_param_block* block = (irt_wi_param_block*)malloc(sizeof(irt_wi_param_block) + size);
+	block->ref_count = 1;
+	block->params = (irt_lw_data_item*)(block + 1);
+	memcpy(block->params, params, size);
+	return block;
+}
+static inline void irt_wi_param_block_retain(irt_wi_param_block* block) {
+	irt_atomic_inc(&block->ref_count, uint32);
+}
+static inline void irt_wi_param_block_release(irt_wi_param_block* block) {
+	if(irt_atomic_sub_and_fetch(&block->ref_count, 1, uint32) == 0) { free(block); }
+}
+
+static inline void _irt_wi_init_common(irt_worker* self, irt_work_item* wi, irt_work_item_id id, const irt_work_item_range* range,
+                                       irt_wi_implementation* impl) {
+	wi->id = id;
 	wi->id.cached = wi;
 	wi->parent_id = irt_work_item_null_id();
 	wi->impl = impl;
@@ -117,17 +134,6 @@ static inline void _irt_wi_init(irt_worker* self, irt_work_item* wi, const irt_w
 	wi->num_groups = 0;
 	wi->_num_active_children = 0;
 	wi->num_active_children = &(wi->_num_active_children);
-	if(params != NULL) {
-		uint32 size = irt_type_get_bytes(self->cur_context.cached, params->type_id);
-		if(size <= IRT_WI_PARAM_BUFFER_SIZE) {
-			wi->parameters = &wi->param_buffer;
-		} else {
-			wi->parameters = (irt_lw_data_item*)malloc(size);
-		}
-		memcpy(wi->parameters, params, size);
-	} else {
-		wi->parameters = NULL;
-	}
 	wi->range = *range;
 	irt_atomic_store(&wi->state, IRT_WI_STATE_NEW);
 	wi->source_id = irt_work_item_null_id();
@@ -146,9 +152,34 @@ static inline void _irt_wi_init(irt_worker* self, irt_work_item* wi, const irt_w
 	irt_inst_region_wi_init(wi);
 }
 
-irt_work_item* _irt_wi_create(irt_worker* self, const irt_work_item_range* range, irt_wi_implementation* impl, irt_lw_data_item* params) {
-	irt_work_item* retval = _irt_wi_new(self);
-	_irt_wi_init(self, retval, range, impl, params);
+static inline void _irt_wi_init_params(irt_worker* self, irt_work_item* wi, irt_lw_data_item* params) {
+	wi->param_block = NULL;
+	if(params != NULL) {
+		uint32 size = irt_type_get_bytes(self->cur_context.cached, params->type_id);
+		if(size <= IRT_WI_PARAM_BUFFER_SIZE) {
+			wi->parameters = &wi->param_buffer;
+			memcpy(wi->parameters, params, size);
+		} else {
+			wi->param_block = irt_wi_param_block_create(self->cur_context.cached, params);
+			wi->parameters = wi->param_block->params;
+		}
+	} else {
+		wi->parameters = NULL;
+	}
+}
+
+static inline void _irt_wi_init_shared_params(irt_work_item* wi, irt_wi_param_block* params) {
+	irt_wi_param_block_retain(params);
+	wi->param_block = params;
+	wi->parameters = params->params;
+}
+
+static inline void _irt_wi_init(irt_worker* self, irt_work_item* wi, const irt_work_item_range* range, irt_wi_implementation* impl, irt_lw_data_item* params) {
+	_irt_wi_init_common(self, wi, irt_generate_work_item_id(IRT_LOOKUP_GENERATOR_ID_PTR), range, impl);
+	_irt_wi_init_params(self, wi, params);
+}
+
+static inline void _irt_wi_register_created(irt_worker* self, irt_work_item* wi) {
 	if(self->cur_wi != NULL) {
 		// increment child count in current wi
 		irt_atomic_inc(self->cur_wi->num_active_children, uint32);
@@ -156,8 +187,14 @@ irt_work_item* _irt_wi_create(irt_worker* self, const irt_work_item_range* range
 	// IRT_DEBUG(" * %p created by %p (%d active children, address: %p) \n", (void*) retval, (void*) self->cur_wi, self->cur_wi ?
 	// *self->cur_wi->num_active_children : -1, self->cur_wi ? (void*) self->cur_wi->num_active_children : NULL);
 	// create entry in event table
-	irt_wi_event_register_create(retval->id);
-	irt_inst_insert_wi_event(self, IRT_INST_WORK_ITEM_CREATED, retval->id);
+	irt_wi_event_register_create(wi->id);
+	irt_inst_insert_wi_event(self, IRT_INST_WORK_ITEM_CREATED, wi->id);
+}
+
+irt_work_item* _irt_wi_create(irt_worker* self, const irt_work_item_range* range, irt_wi_implementation* impl, irt_lw_data_item* params) {
+	irt_work_item* retval = _irt_wi_new(self);
+	_irt_wi_init(self, retval, range, impl, params);
+	_irt_wi_register_created(self, retval);
 	return retval;
 }
 static inline irt_work_item* irt_wi_create(irt_work_item_range range, irt_wi_implementation* impl, irt_lw_data_item* params) {
@@ -167,11 +204,53 @@ static inline irt_work_item* irt_wi_create(irt_work_item_range range, irt_wi_imp
 	irt_inst_region_list_copy(wi, self->cur_wi); // TODO philipp fix your shit
 	return wi;
 }
-irt_work_item* _irt_wi_create_fragment(irt_work_item* source, irt_work_item_range range) {
+irt_work_item* _irt_wi_create_shared(irt_worker* self, const irt_work_item_range* range, irt_wi_implementation* impl, irt_wi_param_block* params) {
+	irt_work_item* retval = _irt_wi_new(self);
+	_irt_wi_init_common(self, retval, irt_generate_work_item_id(IRT_LOOKUP_GENERATOR_ID_PTR), range, impl);
+	_irt_wi_init_shared_params(retval, params);
+	_irt_wi_register_created(self, retval);
+	return retval;
+}
+static inline irt_work_item* irt_wi_create_shared(irt_work_item_range range, irt_wi_implementation* impl, irt_wi_param_block* params) {
 	irt_worker* self = irt_worker_get_current();
+	irt_work_item* wi = _irt_wi_create_shared(self, &range, impl, params);
+	irt_inst_region_list_copy(wi, self->cur_wi);
+	return wi;
+}
+void _irt_wi_create_batch(irt_worker* self, uint32 count, const irt_work_item_range* range, irt_wi_implementation* impl, irt_lw_data_item* params,
+                          irt_work_item** out_wis) {
+	if(count == 0) { return; }
+	// siblings share a single copy of parameters which do not fit the inline buffer
+	irt_wi_param_block* shared_params = NULL;
+	if(params != NULL && irt_type_get_bytes(self->cur_context.cached, params->type_id) > IRT_WI_PARAM_BUFFER_SIZE) {
+		shared_params = irt_wi_param_block_create(self->cur_context.cached, params);
+	}
+	irt_work_item_id id = irt_generate_work_item_id_range(&self->generator_id, count);
+	if(self->cur_wi != NULL) { irt_atomic_fetch_and_add(self->cur_wi->num_active_children, count, uint32); }
+	for(uint32 i = 0; i < count; ++i, ++id.index) {
+		irt_work_item* wi = _irt_wi_new(self);
+		_irt_wi_init_common(self, wi, id, range, impl);
+		if(shared_params) {
+			_irt_wi_init_shared_params(wi, shared_params);
+		} else {
+			_irt_wi_init_params(self, wi, params);
+		}
+		irt_wi_event_register_create(wi->id);
+		irt_inst_insert_wi_event(self, IRT_INST_WORK_ITEM_CREATED, wi->id);
+		irt_inst_region_list_copy(wi, self->cur_wi);
+		out_wis[i] = wi;
+	}
+	// drop the reference held during creation
+	if(shared_params) { irt_wi_param_block_release(shared_params); }
+}
+static inline void irt_wi_create_batch(uint32 count, irt_work_item_range range, irt_wi_implementation* impl, irt_lw_data_item* params, irt_work_item** out_wis) {
+	_irt_wi_create_batch(irt_worker_get_current(), count, &range, impl, params, out_wis);
+}
+irt_work_item* _irt_wi_create_fragment(irt_worker* self, irt_work_item* source, irt_work_item_id id, irt_work_item_range range) {
 	irt_work_item* retval = _irt_wi_new(self);
-	memcpy(retval, source, sizeof(irt_work_item));
-	retval->id = irt_generate_work_item_id(IRT_LOOKUP_GENERATOR_ID_PTR);
+	// fragments reference the parameters of their source, which outlives them - the inline buffer need not be copied
+	memcpy(retval, source, offsetof(irt_work_item, param_buffer));
+	retval->id = id;
 	retval->id.cached = retval;
 	retval->num_fragments = 0;
 	retval->range = range;
@@ -328,8 +407,8 @@ void irt_wi_end(irt_work_item* wi) {
 		IRT_DEBUG("Fragment end, remaining %d", source->num_fragments);
 		if(irt_atomic_sub_and_fetch(&source->num_fragments, 1, uint32) == 0) { irt_wi_end(source); }
 	} else {
-		// delete params struct
-		if(wi->parameters != &wi->param_buffer) { free(wi->parameters); }
+		// release params struct
+		if(wi->param_block) { irt_wi_param_block_release(wi->param_block); }
 	}
 
 	// update state
@@ -440,10 +519,11 @@ void irt_wi_split(irt_work_item* wi, uint32 elements, uint64* offsets, irt_work_
 	}
 	irt_worker* self = irt_worker_get_current();
 	irt_work_item_range range = wi->range;
-	for(uint32 i = 0; i < elements; ++i) {
+	irt_work_item_id id = irt_generate_work_item_id_range(&self->generator_id, elements);
+	for(uint32 i = 0; i < elements; ++i, ++id.index) {
 		range.begin = offsets[i];
 		range.end = i + 1 < elements ? offsets[i + 1] : wi->range.end;
-		out_wis[i] = _irt_wi_create_fragment(wi, range);
+		out_wis[i] = _irt_wi_create_fragment(self, wi, id, range);
 	}
 
 	irt_inst_insert_wi_event(self, IRT_INST_WORK_ITEM_SPLITTED, wi->id);
@@ -136,6 +136,8 @@ void* _irt_worker_func(void* argvp) {
 	self->cur_wi = NULL;
 	self->finalize_wi = NULL;
 	self->default_variant = 0;
+	self->share_first = 0;
+	self->share_count = irt_g_worker_count;
 	if(getenv(IRT_DEFAULT_VARIANT_ENV)) { self->default_variant = atoi(getenv(IRT_DEFAULT_VARIANT_ENV)); }
 
 	#ifdef IRT_WORKER_SLEEPING
@@ -230,6 +232,7 @@ void _irt_worker_switch_to_wi(irt_worker* self, irt_work_item* wi) {
 		current_state = irt_atomic_load(&wi->state);
 	} while(current_state != IRT_WI_STATE_NEW && current_state != IRT_WI_STATE_SUSPENDED);
 
+	irt_worker_idle_end(self);
 	self->cur_context = wi->context_id;
 	if(irt_atomic_load(&wi->state) == IRT_WI_STATE_NEW) {
 		// start WI from scratch
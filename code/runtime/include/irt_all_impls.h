@@ -44,6 +44,7 @@
 #include "impl/error_handling.impl.h"
 #include "impl/worker.impl.h"
 #include "impl/irt_scheduling.impl.h"
+#include "impl/irt_dop_control.impl.h"
 #include "impl/data_item.impl.h"
 #include "impl/work_group.impl.h"
 #include "impl/irt_events.impl.h"
@@ -75,6 +75,13 @@ struct _irt_context {
 	#ifdef IRT_ENABLE_OPENCL
 	irt_opencl_context opencl_context;
 	#endif
+
+	// share of the worker pool when multiple client applications are run by the same runtime,
+	// maintained by irt_context_add_tenant / irt_context_remove_tenant (num_workers == 0 => all workers)
+	uint32 weight;
+	uint32 first_worker;
+	uint32 num_workers;
+
 	// private implementation detail
 	struct _irt_context* lookup_table_next;
 };
@@ -89,5 +96,16 @@ irt_context* irt_context_create_standalone(init_context_fun*, cleanup_context_fu
 void irt_context_initialize(irt_context* context);
 void irt_context_destroy(irt_context* context);
 
+/** Registers the context as a tenant of the worker pool and repartitions the workers among all tenants,
+ ** proportional to their weights. Each tenant is assigned a contiguous range of at least one worker.
+ **/
+void irt_context_add_tenant(irt_context* context, uint32 weight);
+void irt_context_remove_tenant(irt_context* context);
+
+/** Retrieves the range of workers [first, first+count) assigned to the given context.
+ ** Contexts which are not registered as tenants (e.g. in standalone mode) may use all workers.
+ **/
+static inline void irt_context_get_worker_share(irt_context_id context_id, uint32* first, uint32* count);
+
 
 #endif // ifndef __GUARD_IRT_CONTEXT_H
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#pragma once
+#ifndef __GUARD_IRT_DOP_CONTROL_H
+#define __GUARD_IRT_DOP_CONTROL_H
+
+// Insieme runtime degree of parallelism controller
+//
+// Periodically (on the maintenance thread) samples the throughput of instrumented regions and
+// the idle time of active workers, and grows or shrinks the number of active workers using
+// irt_scheduling_set_dop. A step which did not pay off is reverted and the controller holds
+// the current degree of parallelism for a number of samples before probing again.
+//
+// The controller requires the maintenance thread (IRT_ENABLE_REGION_INSTRUMENTATION) and is
+// enabled at runtime by setting IRT_DOP_CONTROL. IRT_DOP_CONTROL_MIN and IRT_DOP_CONTROL_MAX
+// impose hard limits on the number of active workers.
+
+#include "declarations.h"
+#include "irt_context.h"
+#include "abstraction/spin_locks.h"
+
+// fraction of time active workers may spend without work before one of them is released
+#define IRT_DOP_CONTROL_IDLE_THRESHOLD 0.25
+// minimal relative change in throughput for a step to be considered successful
+#define IRT_DOP_CONTROL_MIN_GAIN 0.05
+// number of samples to keep the degree of parallelism after reverting a step
+#define IRT_DOP_CONTROL_HOLD_SAMPLES 10
+
+typedef struct {
+	uint32 min_dop;
+	uint32 max_dop;
+	uint32 cur_dop;           // degree of parallelism during the current sample interval
+	uint32 last_dop;          // degree of parallelism during the previous sample interval
+	double last_throughput;   // region executions per second during the previous sample interval
+	uint32 hold;              // remaining samples before probing again
+	uint64 last_time_ns;      // time of the last sample
+	uint64 last_idle_ticks;   // sum of worker idle ticks at the last sample
+	uint64 last_executions;   // sum of region executions at the last sample
+	irt_context* context;     // context whose regions are sampled, NULL if none
+	irt_spinlock context_lock;
+} irt_dop_control_state;
+
+// computes the degree of parallelism for the next interval, given the measurements of the one which just ended
+uint32 irt_dop_control_decide(irt_dop_control_state* state, uint64 interval_ns, uint64 idle_ns, uint64 region_executions);
+
+void irt_dop_control_init();
+
+// starts the controller if requested by IRT_DOP_CONTROL, needs to be called after all workers have been created
+void irt_dop_control_start();
+
+void irt_dop_control_cleanup();
+
+// sets the context whose instrumented regions are used to measure throughput
+void irt_dop_control_attach_context(irt_context* context);
+
+void irt_dop_control_detach_context(irt_context* context);
+
+#endif // ifndef __GUARD_IRT_DOP_CONTROL_H
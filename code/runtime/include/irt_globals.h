@@ -48,6 +48,10 @@
 #include <hwloc.h>
 #endif
 
+#ifndef IRT_MIN_MODE
+#include <mqueue.h>
+#endif
+
 #include "irt_globals.inc"
 
 #endif // ifndef __GUARD_GLOBALS_H
@@ -65,6 +65,7 @@ typedef struct _irt_mqueue_msg {
 typedef struct _irt_mqueue_msg_new_app {
 	irt_mqueue_msg_type type;
 	size_t size;
+	uint32 weight; // fair-share weight of the application, see irt_context_add_tenant
 	char app_name[128];
 } irt_mqueue_msg_new_app;
 
@@ -74,8 +75,13 @@ typedef struct _irt_mqueue_msg_new_app {
 void irt_mqueue_init();
 void irt_mqueue_cleanup();
 
+/** Connects to the message queue of an already running runtime instance,
+ ** used by clients submitting applications to a runtime service.
+ **/
+void irt_mqueue_connect();
+
 void irt_mqueue_send(const irt_mqueue_msg* msg);
-void irt_mqueue_send_new_app(const char* appname);
+void irt_mqueue_send_new_app(const char* appname, uint32 weight);
 
 /** Retrieves a message from the IRT message queue,
  ** NULL is returned if the message queue is empty.
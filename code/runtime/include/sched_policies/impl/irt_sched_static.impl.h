@@ -78,14 +78,17 @@ int irt_scheduling_iteration(irt_worker* self) {
 }
 
 void irt_scheduling_assign_wi(irt_worker* target, irt_work_item* wi) {
-	// split wis equally among workers
+	// split wis equally among the workers assigned to the wi's context
+	uint32 first_worker, num_workers;
+	irt_context_get_worker_share(wi->context_id, &first_worker, &num_workers);
 	int64 size = irt_wi_range_get_size(&wi->range);
-	if(size > 1 && size >= irt_g_worker_count) {
-		irt_work_item** split_wis = (irt_work_item**)alloca(irt_g_worker_count * sizeof(irt_work_item*));
-		irt_wi_split_uniform(wi, irt_g_worker_count, split_wis);
-		for(uint32 i = 0; i < irt_g_worker_count; ++i) {
-			irt_work_item_cdeque_insert_back(&irt_g_workers[i]->sched_data.queue, split_wis[i]);
-			irt_signal_worker(irt_g_workers[i]);
+	if(size > 1 && size >= num_workers) {
+		irt_work_item** split_wis = (irt_work_item**)alloca(num_workers * sizeof(irt_work_item*));
+		irt_wi_split_uniform(wi, num_workers, split_wis);
+		for(uint32 i = 0; i < num_workers; ++i) {
+			irt_worker* worker = irt_g_workers[first_worker + i];
+			irt_work_item_cdeque_insert_back(&worker->sched_data.queue, split_wis[i]);
+			irt_signal_worker(worker);
 		}
 		#ifdef _GEMS_SIM
 		// alloca is implemented as malloc
@@ -218,9 +218,10 @@ int irt_scheduling_iteration(irt_worker* self) {
 		return 1;
 	}
 
-	// try to steal a work item from random
+	// try to steal a work item from random, staying within the share of the worker pool assigned to our application
 	irt_inst_insert_wo_event(self, IRT_INST_WORKER_STEAL_TRY, self->id);
-	irt_worker* wo = irt_g_workers[rand_r(&self->rand_seed) % irt_g_worker_count];
+	// (the share may be updated concurrently, hence the wrap around)
+	irt_worker* wo = irt_g_workers[(self->share_first + rand_r(&self->rand_seed) % self->share_count) % irt_g_worker_count];
 	#ifdef IRT_STEAL_OTHER_POP_FRONT
 	if((wi = irt_cwb_pop_front(&wo->sched_data.queue))) {
 	#else
@@ -47,20 +47,84 @@
 #include "impl/irt_mqueue.impl.h"
 #endif
 
+#ifndef IRT_MIN_MODE
+
+// a client application sharing the worker pool of the runtime service
+typedef struct __irt_sched_ipc_tenant {
+	irt_context* context;
+	irt_wi_event_lambda completion_handler;
+	struct __irt_sched_ipc_tenant* next;
+} _irt_sched_ipc_tenant;
+
+// applications which have finished and wait to be torn down, protected by irt_g_tenant_mutex
+static _irt_sched_ipc_tenant* _irt_sched_ipc_finished_tenants = NULL;
+
+static bool _irt_sched_ipc_tenant_completed(void* data) {
+	_irt_sched_ipc_tenant* tenant = (_irt_sched_ipc_tenant*)data;
+	// hand the workers to the remaining applications right away, but defer the tear down
+	// since the main work item is still being finalized while this handler runs
+	irt_context_remove_tenant(tenant->context);
+	irt_mutex_lock(&irt_g_tenant_mutex);
+	tenant->next = _irt_sched_ipc_finished_tenants;
+	_irt_sched_ipc_finished_tenants = tenant;
+	irt_mutex_unlock(&irt_g_tenant_mutex);
+	return false;
+}
+
+static inline void _irt_sched_ipc_reap_tenants() {
+	if(_irt_sched_ipc_finished_tenants == NULL) { return; }
+	irt_mutex_lock(&irt_g_tenant_mutex);
+	_irt_sched_ipc_tenant* finished = _irt_sched_ipc_finished_tenants;
+	_irt_sched_ipc_finished_tenants = NULL;
+	irt_mutex_unlock(&irt_g_tenant_mutex);
+	while(finished) {
+		_irt_sched_ipc_tenant* next = finished->next;
+		irt_client_app* client_app = finished->context->client_app;
+		irt_context_destroy(finished->context);
+		irt_client_app_destroy(client_app);
+		free(finished);
+		finished = next;
+	}
+}
+
+static inline void _irt_sched_ipc_start_app(irt_worker* self, const irt_mqueue_msg_new_app* appmsg) {
+	irt_client_app* client_app = irt_client_app_create(appmsg->app_name, appmsg->weight);
+	irt_context* prog_context = irt_context_create(client_app, NULL, NULL);
+	irt_context_add_tenant(prog_context, client_app->weight);
+	IRT_ASSERT(prog_context->impl_table_size > 0, IRT_ERR_APP, "Client application %s does not provide a startup implementation", appmsg->app_name);
+
+	// the main work item inherits the context of the current worker
+	irt_context_id service_context = self->cur_context;
+	self->cur_context = prog_context->id;
+	irt_work_item* main_wi = irt_wi_create(irt_g_wi_range_one_elem, &prog_context->impl_table[0], NULL);
+	self->cur_context = service_context;
+	irt_work_group* outer_wg = irt_wg_create();
+	irt_wg_insert(outer_wg, main_wi);
+
+	_irt_sched_ipc_tenant* tenant = (_irt_sched_ipc_tenant*)malloc(sizeof(_irt_sched_ipc_tenant));
+	tenant->context = prog_context;
+	tenant->next = NULL;
+	tenant->completion_handler.next = NULL;
+	tenant->completion_handler.data = tenant;
+	tenant->completion_handler.func = &_irt_sched_ipc_tenant_completed;
+	irt_wi_event_handler_register(main_wi->id, IRT_WI_EV_COMPLETED, &tenant->completion_handler);
+
+	// start the application on its own share of the worker pool
+	irt_scheduling_assign_wi(irt_g_workers[prog_context->first_worker], main_wi);
+}
+
+#endif // ifndef IRT_MIN_MODE
+
 static inline int _irt_sched_check_ipc_queue(irt_worker* self) {
 	int retval = 0;
 	#ifndef IRT_MIN_MODE
 	if(irt_g_runtime_behaviour & IRT_RT_MQUEUE) {
+		_irt_sched_ipc_reap_tenants();
 		irt_mqueue_msg* received = irt_mqueue_receive();
 		if(received) {
-			if(received->type == IRT_MQ_NEW_APP) {
-				irt_mqueue_msg_new_app* appmsg = (irt_mqueue_msg_new_app*)received;
-				irt_client_app* client_app = irt_client_app_create(appmsg->app_name);
-				irt_context* prog_context = irt_context_create(client_app, NULL, NULL);
-				self->cur_context = prog_context->id;
-				_irt_worker_switch_to_wi(self, irt_wi_create(irt_g_wi_range_one_elem, 0, NULL));
-				retval = 1;
-			}
+			// the main work item of a new application is assigned to its share of the workers,
+			// so the caller does not get a work item to switch to
+			if(received->type == IRT_MQ_NEW_APP) { _irt_sched_ipc_start_app(self, (irt_mqueue_msg_new_app*)received); }
 			free(received);
 		}
 	}
@@ -68,5 +132,4 @@ static inline int _irt_sched_check_ipc_queue(irt_worker* self) {
 	return retval;
 }
 
-
 #endif // ifndef __GUARD_SCHED_POLICIES_UTILS_IMPL_IRT_SCHED_IPC_BASE_IMPL_H
@@ -77,6 +77,12 @@
 void irt_runtime_standalone(uint32 worker_count, init_context_fun* init_fun, cleanup_context_fun* cleanup_fun, irt_wi_implementation* impl,
                             irt_lw_data_item* startup_params);
 
+/** Starts the runtime as a service executing client applications submitted through the IPC message queue
+  * (see irt_mqueue_send_new_app). All applications share the worker pool according to their weights.
+  * worker_count : number of workers to start
+  */
+irt_context* irt_runtime_start_service(uint32 worker_count);
+
 // globals
 #define __EXTERN
 #include "irt_globals.inc"
@@ -113,11 +119,14 @@ void irt_init_globals() {
 	irt_mutex_init(&irt_g_exit_handler_mutex);
 	irt_mutex_init(&irt_g_degree_of_parallelism_mutex);
 	irt_mutex_init(&irt_g_active_worker_mutex);
+	irt_mutex_init(&irt_g_tenant_mutex);
+	irt_g_tenant_count = 0;
 	irt_data_item_table_init();
 	irt_context_table_init();
 	irt_wi_event_register_table_init();
 	irt_wg_event_register_table_init();
 	irt_loop_sched_policy_init();
+	irt_dop_control_init();
 	#ifndef IRT_MIN_MODE
 	if(irt_g_runtime_behaviour & IRT_RT_MQUEUE) { irt_mqueue_init(); }
 	#endif
@@ -176,6 +185,7 @@ void irt_exit_handler() {
 
 	if(irt_g_exit_handling_done) { return; }
 
+	irt_dop_control_cleanup();
 	_irt_worker_end_all();
 
 	// reset the clock frequency of the cores of all workers
@@ -262,6 +272,7 @@ void irt_runtime_start(irt_runtime_behaviour_flags behaviour, uint32 worker_coun
 
 	// initialize affinity mapping & load affinity policy
 	irt_affinity_init_physical_mapping(&irt_g_affinity_physical_mapping);
+	irt_affinity_init_topology(&irt_g_affinity_topology);
 	irt_affinity_policy aff_policy = irt_load_affinity_from_env();
 
 	// initialize workers
@@ -277,6 +288,14 @@ void irt_runtime_start(irt_runtime_behaviour_flags behaviour, uint32 worker_coun
 	// wait until all workers have signaled readiness
 	_irt_wake_sleeping_workers(&signalStruct, ev_handle);
 
+	#if defined IRT_ENABLE_REGION_INSTRUMENTATION && !defined _GEMS
+	// move the maintenance thread to the cores reserved by the affinity policy, if any
+	irt_affinity_mask reserved_mask = irt_affinity_get_reserved_mask(aff_policy);
+	if(!irt_affinity_mask_is_empty(reserved_mask)) { irt_set_affinity(reserved_mask, irt_g_maintenance_thread); }
+	#endif // IRT_ENABLE_REGION_INSTRUMENTATION
+
+	irt_dop_control_start();
+
 	// signal and exit handling needs to be registered after all workers have inited
 	// otherwise there is potential for the access of uninitialized per-worker locks
 	#ifndef _GEMS_SIM
@@ -341,19 +360,21 @@ void irt_runtime_run_wi(irt_wi_implementation* impl, irt_lw_data_item* params) {
 	irt_cond_bundle_destroy(&condbundle);
 }
 
-irt_context* irt_runtime_start_in_context(uint32 worker_count, init_context_fun* init_fun, cleanup_context_fun* cleanup_fun, bool handle_signals) {
+static irt_context* _irt_runtime_start_in_context(irt_runtime_behaviour_flags behaviour, uint32 worker_count, init_context_fun* init_fun,
+                                                  cleanup_context_fun* cleanup_fun, bool handle_signals) {
 #ifdef _GEMS_SIM
 	irt_mutex_init(&print_mutex);
 	#endif
 	IRT_DEBUG("Workers count: %d\n", worker_count);
 	// initialize globals
+	irt_g_runtime_behaviour = behaviour;
 	irt_init_globals();
 	irt_worker tempw;
 	tempw.generator_id = 0;
 	irt_tls_set(irt_g_worker_key, &tempw); // slightly hacky
 
 	irt_context* context = irt_context_create_standalone(init_fun, cleanup_fun);
-	irt_runtime_start(IRT_RT_STANDALONE, worker_count, handle_signals);
+	irt_runtime_start(behaviour, worker_count, handle_signals);
 
 	// assure that the early context can be obtained during custom init
 	tempw.cur_context = context->id;
@@ -367,6 +388,22 @@ irt_context* irt_runtime_start_in_context(uint32 worker_count, init_context_fun*
 	return context;
 }
 
+irt_context* irt_runtime_start_in_context(uint32 worker_count, init_context_fun* init_fun, cleanup_context_fun* cleanup_fun, bool handle_signals) {
+	return _irt_runtime_start_in_context(IRT_RT_STANDALONE, worker_count, init_fun, cleanup_fun, handle_signals);
+}
+
+void _irt_runtime_service_context_fun(irt_context* c) {
+	c->impl_table_size = 0;
+	c->info_table_size = 0;
+	c->type_table_size = 0;
+	c->num_regions = 0;
+}
+
+irt_context* irt_runtime_start_service(uint32 worker_count) {
+	// the service context only hosts idle workers, client applications get contexts of their own (see _irt_sched_check_ipc_queue)
+	return _irt_runtime_start_in_context(IRT_RT_MQUEUE, worker_count, &_irt_runtime_service_context_fun, &_irt_runtime_service_context_fun, true);
+}
+
 void irt_runtime_end_in_context(irt_context* context) {
 	_irt_worker_end_all();
 	irt_context_destroy(context);
@@ -55,6 +55,9 @@ typedef enum {
 	IRT_AFFINITY_FIXED = 1,
 	IRT_AFFINITY_FILL = 10,
 	IRT_AFFINITY_SKIP = 20,
+	IRT_AFFINITY_COMPACT = 30,        // fill all hardware threads of a core before moving on to the next core
+	IRT_AFFINITY_SCATTER = 40,        // distribute workers evenly across sockets, one per core before using SMT siblings
+	IRT_AFFINITY_PHYSICAL_CORES = 50, // one worker per physical core, SMT siblings remain unused
 	IRT_AFFINITY_MAX_DISTANCE = 100
 	//	IRT_AFFINITY_MAX_SPREAD = 200
 } irt_affinity_policy_type;
@@ -62,6 +65,8 @@ typedef enum {
 typedef struct {
 	irt_affinity_policy_type type;
 	uint32 skip_count;
+	uint32 reserved_cores; // number of physical cores kept free of workers for the maintenance thread (topology policies only)
+	uint32 fixed_map_size; // number of valid entries in fixed_map for topology based policies
 	uint32 fixed_map[IRT_MAX_CORES];
 } irt_affinity_policy;
 
@@ -73,6 +78,20 @@ typedef struct {
 
 static irt_affinity_physical_mapping irt_g_affinity_physical_mapping;
 
+typedef struct {
+	uint32 socket; // index of the socket containing this cpu
+	uint32 core;   // index of the physical core containing this cpu (unique across sockets)
+	uint32 smt;    // index of this hardware thread within its core
+} irt_affinity_cpu_location;
+
+typedef struct {
+	// location of each virtual cpu-id within the hardware hierarchy, as obtained from hwloc
+	uint32 num_cpus;
+	irt_affinity_cpu_location cpus[IRT_MAX_CORES];
+} irt_affinity_topology;
+
+static irt_affinity_topology irt_g_affinity_topology;
+
 #define IRT_AFFINITY_MASK_BITS_PER_QUAD ((uint64)64)                                 // number of processors identifiable through a bitmask
 #define IRT_AFFINTY_MASK_NUM_QUADS (IRT_MAX_CORES / IRT_AFFINITY_MASK_BITS_PER_QUAD) // number of bitmasks required to capture every processor
 
@@ -109,8 +128,16 @@ static inline uint32 irt_affinity_mask_get_first_cpu(const irt_affinity_mask mas
 
 // affinity policy handling /////////////////////////////////////////////////////////////////////////////////
 
+void irt_affinity_init_topology(irt_affinity_topology* out_topology);
+
 irt_affinity_policy irt_load_affinity_from_env();
 
+// computes the topology-ordered cpu map of the given policy based on irt_g_affinity_topology and irt_g_worker_count
+void irt_affinity_policy_apply_topology(irt_affinity_policy* policy);
+
+// returns the mask of all cpus reserved by the given policy, empty if no cores are reserved
+irt_affinity_mask irt_affinity_get_reserved_mask(irt_affinity_policy policy);
+
 static inline irt_affinity_mask irt_get_affinity(uint32 id, irt_affinity_policy policy);
 
 void irt_set_global_affinity_policy(irt_affinity_policy policy);
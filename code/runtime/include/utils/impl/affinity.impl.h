@@ -108,6 +108,164 @@ static inline uint32 irt_affinity_mask_get_first_cpu(const irt_affinity_mask mas
 }
 
 
+// topology handling -----------------------------------------------------------
+
+static inline uint32 _irt_affinity_physical_to_virtual(uint32 physical) {
+	for(uint32 i = 0; i < IRT_MAX_CORES; ++i) {
+		if(irt_g_affinity_physical_mapping.map[i] == UINT_MAX) { break; }
+		if(irt_g_affinity_physical_mapping.map[i] == physical) { return i; }
+	}
+	return UINT_MAX;
+}
+
+void irt_affinity_init_topology(irt_affinity_topology* out_topology) {
+	uint32 ncpus = irt_hw_get_num_cpus();
+	if(ncpus > IRT_MAX_CORES) { ncpus = IRT_MAX_CORES; }
+	out_topology->num_cpus = ncpus;
+	// without topology information, every cpu is treated as a separate core on a single socket
+	for(uint32 i = 0; i < ncpus; ++i) {
+		out_topology->cpus[i].socket = 0;
+		out_topology->cpus[i].core = i;
+		out_topology->cpus[i].smt = 0;
+	}
+	#ifdef IRT_USE_HWLOC
+	int num_pus = hwloc_get_nbobjs_by_type(irt_g_hwloc_topology, HWLOC_OBJ_PU);
+	for(int i = 0; i < num_pus; ++i) {
+		hwloc_obj_t pu = hwloc_get_obj_by_type(irt_g_hwloc_topology, HWLOC_OBJ_PU, i);
+		uint32 cpu = _irt_affinity_physical_to_virtual(pu->os_index);
+		if(cpu >= ncpus) { continue; }
+		hwloc_obj_t core = hwloc_get_ancestor_obj_by_type(irt_g_hwloc_topology, HWLOC_OBJ_CORE, pu);
+		hwloc_obj_t socket = hwloc_get_ancestor_obj_by_type(irt_g_hwloc_topology, HWLOC_OBJ_SOCKET, pu);
+		out_topology->cpus[cpu].socket = socket ? socket->logical_index : 0;
+		out_topology->cpus[cpu].core = core ? core->logical_index : pu->logical_index;
+		out_topology->cpus[cpu].smt = core ? pu->sibling_rank : 0;
+	}
+	#endif // IRT_USE_HWLOC
+}
+
+#define _IRT_AFFINITY_CMP_FIELD(_a, _b, _field)                                                                                                               \
+	if((_a)->_field != (_b)->_field) { return (_a)->_field < (_b)->_field ? -1 : 1; }
+
+// orders cpus by socket, core and hardware thread -- neighboring entries share as many levels of the hierarchy as possible
+static int _irt_affinity_compare_compact(const void* a, const void* b) {
+	uint32 cpu_a = *(const uint32*)a, cpu_b = *(const uint32*)b;
+	const irt_affinity_cpu_location* la = &irt_g_affinity_topology.cpus[cpu_a];
+	const irt_affinity_cpu_location* lb = &irt_g_affinity_topology.cpus[cpu_b];
+	_IRT_AFFINITY_CMP_FIELD(la, lb, socket);
+	_IRT_AFFINITY_CMP_FIELD(la, lb, core);
+	_IRT_AFFINITY_CMP_FIELD(la, lb, smt);
+	return cpu_a < cpu_b ? -1 : (cpu_a > cpu_b);
+}
+
+// orders cpus by socket first, and within each socket uses one hardware thread of every core before any SMT sibling
+static int _irt_affinity_compare_scatter(const void* a, const void* b) {
+	uint32 cpu_a = *(const uint32*)a, cpu_b = *(const uint32*)b;
+	const irt_affinity_cpu_location* la = &irt_g_affinity_topology.cpus[cpu_a];
+	const irt_affinity_cpu_location* lb = &irt_g_affinity_topology.cpus[cpu_b];
+	_IRT_AFFINITY_CMP_FIELD(la, lb, socket);
+	_IRT_AFFINITY_CMP_FIELD(la, lb, smt);
+	_IRT_AFFINITY_CMP_FIELD(la, lb, core);
+	return cpu_a < cpu_b ? -1 : (cpu_a > cpu_b);
+}
+
+#undef _IRT_AFFINITY_CMP_FIELD
+
+// marks all cpus of the last reserved_cores physical cores (in compact order) as reserved
+static inline void _irt_affinity_get_reserved_cpus(uint32 reserved_cores, bool* out_reserved) {
+	uint32 n = irt_g_affinity_topology.num_cpus;
+	uint32 order[IRT_MAX_CORES];
+	uint32 core_rank[IRT_MAX_CORES];
+	for(uint32 i = 0; i < n; ++i) {
+		order[i] = i;
+		out_reserved[i] = false;
+	}
+	if(reserved_cores == 0 || n == 0) { return; }
+	qsort(order, n, sizeof(uint32), &_irt_affinity_compare_compact);
+	uint32 num_cores = 0;
+	for(uint32 i = 0; i < n; ++i) {
+		if(i == 0 || irt_g_affinity_topology.cpus[order[i]].core != irt_g_affinity_topology.cpus[order[i - 1]].core) { num_cores++; }
+		core_rank[i] = num_cores - 1;
+	}
+	for(uint32 i = 0; i < n; ++i) {
+		if(core_rank[i] + reserved_cores >= num_cores) { out_reserved[order[i]] = true; }
+	}
+}
+
+static inline bool _irt_affinity_is_topology_policy(irt_affinity_policy_type type) {
+	return type == IRT_AFFINITY_COMPACT || type == IRT_AFFINITY_SCATTER || type == IRT_AFFINITY_PHYSICAL_CORES;
+}
+
+void irt_affinity_policy_apply_topology(irt_affinity_policy* policy) {
+	if(!_irt_affinity_is_topology_policy(policy->type)) { return; }
+
+	uint32 n = irt_g_affinity_topology.num_cpus;
+	uint32 order[IRT_MAX_CORES];
+	bool reserved[IRT_MAX_CORES];
+	_irt_affinity_get_reserved_cpus(policy->reserved_cores, reserved);
+	uint32 count = 0;
+	for(uint32 i = 0; i < n; ++i) {
+		if(!reserved[i]) { order[count++] = i; }
+	}
+	if(count == 0) { irt_throw_string_error(IRT_ERR_INIT, "Affinity policy reserves all %u available cores", policy->reserved_cores); }
+
+	const irt_affinity_cpu_location* cpus = irt_g_affinity_topology.cpus;
+	policy->fixed_map_size = 0;
+	if(policy->type == IRT_AFFINITY_COMPACT) {
+		qsort(order, count, sizeof(uint32), &_irt_affinity_compare_compact);
+		for(uint32 i = 0; i < count; ++i) {
+			policy->fixed_map[policy->fixed_map_size++] = order[i];
+		}
+	} else if(policy->type == IRT_AFFINITY_PHYSICAL_CORES) {
+		qsort(order, count, sizeof(uint32), &_irt_affinity_compare_compact);
+		for(uint32 i = 0; i < count; ++i) {
+			if(i == 0 || cpus[order[i]].core != cpus[order[i - 1]].core) { policy->fixed_map[policy->fixed_map_size++] = order[i]; }
+		}
+	} else if(policy->type == IRT_AFFINITY_SCATTER) {
+		qsort(order, count, sizeof(uint32), &_irt_affinity_compare_scatter);
+		// determine the range of each socket within the order
+		uint32 socket_start[IRT_MAX_CORES], socket_size[IRT_MAX_CORES], socket_quota[IRT_MAX_CORES];
+		uint32 num_sockets = 0;
+		for(uint32 i = 0; i < count; ++i) {
+			if(i == 0 || cpus[order[i]].socket != cpus[order[i - 1]].socket) {
+				socket_start[num_sockets] = i;
+				socket_size[num_sockets] = 0;
+				socket_quota[num_sockets] = 0;
+				num_sockets++;
+			}
+			socket_size[num_sockets - 1]++;
+		}
+		// hand out workers round-robin to sockets which still have unused cpus
+		uint32 workers = irt_g_worker_count > 0 ? irt_g_worker_count : count;
+		uint32 assigned = 0;
+		while(assigned < workers && assigned < count) {
+			for(uint32 s = 0; s < num_sockets && assigned < workers; ++s) {
+				if(socket_quota[s] < socket_size[s]) {
+					socket_quota[s]++;
+					assigned++;
+				}
+			}
+		}
+		// consecutive worker ids are placed on the same socket, to keep neighbor stealing local
+		for(uint32 s = 0; s < num_sockets; ++s) {
+			for(uint32 i = 0; i < socket_quota[s]; ++i) {
+				policy->fixed_map[policy->fixed_map_size++] = order[socket_start[s] + i];
+			}
+		}
+	}
+}
+
+irt_affinity_mask irt_affinity_get_reserved_mask(irt_affinity_policy policy) {
+	irt_affinity_mask mask = irt_g_empty_affinity_mask;
+	if(!_irt_affinity_is_topology_policy(policy.type) || policy.reserved_cores == 0) { return mask; }
+	bool reserved[IRT_MAX_CORES];
+	_irt_affinity_get_reserved_cpus(policy.reserved_cores, reserved);
+	for(uint32 i = 0; i < irt_g_affinity_topology.num_cpus; ++i) {
+		if(reserved[i]) { irt_affinity_mask_set(&mask, i, true); }
+	}
+	return mask;
+}
+
+
 // affinity policy handling ----------------------------------------------------
 
 irt_affinity_mask _irt_get_affinity_max_distance(uint32 id) {
@@ -126,7 +284,7 @@ irt_affinity_mask _irt_get_affinity_max_distance(uint32 id) {
 
 irt_affinity_policy irt_load_affinity_from_env() {
 	char* policy_str = getenv(IRT_AFFINITY_POLICY_ENV);
-	irt_affinity_policy policy = {IRT_AFFINITY_NONE, 0};
+	irt_affinity_policy policy = {IRT_AFFINITY_NONE, 0, 0, 0};
 	if(policy_str) {
 		irt_log_setting_s(IRT_AFFINITY_POLICY_ENV, policy_str);
 		char* tok = strtok(policy_str, ", :");
@@ -149,9 +307,21 @@ irt_affinity_policy irt_load_affinity_from_env() {
 			policy.skip_count = atoi(tok);
 		} else if(strcmp("IRT_AFFINITY_MAX_DISTANCE", tok) == 0) {
 			policy.type = IRT_AFFINITY_MAX_DISTANCE;
+		} else if(strcmp("IRT_AFFINITY_COMPACT", tok) == 0) {
+			policy.type = IRT_AFFINITY_COMPACT;
+		} else if(strcmp("IRT_AFFINITY_SCATTER", tok) == 0) {
+			policy.type = IRT_AFFINITY_SCATTER;
+		} else if(strcmp("IRT_AFFINITY_PHYSICAL_CORES", tok) == 0) {
+			policy.type = IRT_AFFINITY_PHYSICAL_CORES;
 		} else {
 			irt_throw_string_error(IRT_ERR_INIT, "Unknown affinity policy type: %s", tok);
 		}
+		if(_irt_affinity_is_topology_policy(policy.type)) {
+			// optional number of physical cores to reserve for the maintenance thread
+			tok = strtok(NULL, ", ");
+			if(tok != NULL) { policy.reserved_cores = atoi(tok); }
+			irt_affinity_policy_apply_topology(&policy);
+		}
 	} else {
 		irt_log_setting_s(IRT_AFFINITY_POLICY_ENV, "IRT_AFFINITY_NONE");
 		policy.type = IRT_AFFINITY_NONE;
@@ -163,6 +333,10 @@ static inline irt_affinity_mask irt_get_affinity(uint32 id, irt_affinity_policy
 	if(policy.type == IRT_AFFINITY_NONE) { return irt_g_empty_affinity_mask; }
 	if(policy.type == IRT_AFFINITY_MAX_DISTANCE) { return _irt_get_affinity_max_distance(id); }
 	if(policy.type == IRT_AFFINITY_FIXED) { return irt_affinity_mask_create_single_cpu(policy.fixed_map[id]); }
+	if(_irt_affinity_is_topology_policy(policy.type)) {
+		IRT_ASSERT(policy.fixed_map_size > 0, IRT_ERR_INTERNAL, "Topology affinity policy requested without prior irt_affinity_policy_apply_topology");
+		return irt_affinity_mask_create_single_cpu(policy.fixed_map[id % policy.fixed_map_size]);
+	}
 	uint32 skip = policy.skip_count;
 	if(policy.type == IRT_AFFINITY_FILL) { skip = 0; }
 	skip++;
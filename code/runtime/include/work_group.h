@@ -95,6 +95,8 @@ static inline void _irt_wg_end_member(irt_work_group* wg);
 // inline void irt_wg_leave(irt_work_group* wg);
 
 void irt_wg_insert(irt_work_group* wg, irt_work_item* wi);
+// inserts count wis, which receive consecutive member numbers in the given order
+void irt_wg_insert_batch(irt_work_group* wg, uint32 count, irt_work_item** wis);
 void irt_wg_remove(irt_work_group* wg, irt_work_item* wi);
 
 static inline uint32 irt_wg_get_wi_num(irt_work_group* wg, irt_work_item* wi);
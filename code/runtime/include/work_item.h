@@ -75,6 +75,13 @@ typedef struct _irt_wi_readiness_check {
 } irt_wi_readiness_check;
 irt_wi_readiness_check irt_g_null_readiness_check = {NULL, NULL};
 
+// immutable, reference counted copy of a parameter struct which is shared by multiple work items,
+// used for parameters exceeding the inline buffer of a work item (IRT_WI_PARAM_BUFFER_SIZE)
+typedef struct _irt_wi_param_block {
+	volatile uint32 ref_count;
+	irt_lw_data_item* params; // points to the copy following this header
+} irt_wi_param_block;
+
 struct _irt_work_item {
 	// core functionality
 	irt_work_item_id id;
@@ -91,6 +98,7 @@ struct _irt_work_item {
 	irt_wi_wg_membership* wg_memberships;
 	volatile irt_work_item_state state;
 	irt_lw_data_item* parameters;
+	irt_wi_param_block* param_block; // NULL if the parameters are stored inline or not owned by this wi
 	// wi splitting related
 	irt_work_item_id source_id;
 	uint32 num_fragments;
@@ -127,6 +135,24 @@ static inline irt_work_group* irt_wi_get_wg(irt_work_item* wi, uint32 index);
 irt_work_item* _irt_wi_create(irt_worker* self, const irt_work_item_range* range, irt_wi_implementation* impl, irt_lw_data_item* params);
 static inline irt_work_item* irt_wi_create(irt_work_item_range range, irt_wi_implementation* impl, irt_lw_data_item* params);
 
+static inline irt_wi_param_block* irt_wi_param_block_create(irt_context* context, irt_lw_data_item* params);
+static inline void irt_wi_param_block_retain(irt_wi_param_block* block);
+static inline void irt_wi_param_block_release(irt_wi_param_block* block);
+
+/** Creates a work item referencing the given parameter block instead of copying the parameters.
+ ** Used to create sibling work items which share the same (large) parameter struct.
+ **/
+irt_work_item* _irt_wi_create_shared(irt_worker* self, const irt_work_item_range* range, irt_wi_implementation* impl, irt_wi_param_block* params);
+static inline irt_work_item* irt_wi_create_shared(irt_work_item_range range, irt_wi_implementation* impl, irt_wi_param_block* params);
+
+/** Creates count sibling work items with the same range, implementation and parameters, writing them to out_wis.
+ ** Ids are reserved as one consecutive range and the parent's child count is updated once; parameters exceeding
+ ** the inline buffer are copied once and shared by all siblings.
+ **/
+void _irt_wi_create_batch(irt_worker* self, uint32 count, const irt_work_item_range* range, irt_wi_implementation* impl, irt_lw_data_item* params,
+                          irt_work_item** out_wis);
+static inline void irt_wi_create_batch(uint32 count, irt_work_item_range range, irt_wi_implementation* impl, irt_lw_data_item* params, irt_work_item** out_wis);
+
 // on the WIN64 platform, function _irt_wi_trampoline will be called from a linked obj-file, which implements some
 // functionality in assembly code for  -> thus its name must not be mangled by a c++ compiler -> wrap extern "C" around
 #ifdef __cplusplus
@@ -47,6 +47,7 @@
 #include "utils/minlwt.h"
 #include "instrumentation_events.h"
 #include "utils/affinity.h"
+#include "abstraction/rdtsc.h"
 
 /* ------------------------------ data structures ----- */
 
@@ -87,10 +88,20 @@ struct _irt_worker {
 	uint32 default_variant;
 	unsigned int rand_seed;
 
+	// range of workers sharing work with this one, restricted to the share of its client application (see irt_context_add_tenant)
+	volatile uint32 share_first;
+	volatile uint32 share_count;
+
 	#ifdef IRT_ASTEROIDEA_STACKS
 	irt_work_item* share_stack_wi;
 	#endif
 
+	#ifdef IRT_DOP_CONTROL_AVAILABLE
+	// time spent without work, used by the degree of parallelism controller
+	volatile uint64 idle_ticks;
+	volatile uint64 idle_since;
+	#endif // IRT_DOP_CONTROL_AVAILABLE
+
 	#ifdef IRT_ENABLE_APP_TIME_ACCOUNTING
 	clockid_t clockid;
 	double app_time_total;
@@ -128,6 +139,22 @@ static inline irt_worker* irt_worker_get_current() {
 	return w;
 }
 
+// mark the begin and end of a period in which the worker does not find any work
+static inline void irt_worker_idle_begin(irt_worker* self) {
+	#ifdef IRT_DOP_CONTROL_AVAILABLE
+	if(self->idle_since == 0) { self->idle_since = irt_time_ticks(); }
+	#endif
+}
+
+static inline void irt_worker_idle_end(irt_worker* self) {
+	#ifdef IRT_DOP_CONTROL_AVAILABLE
+	if(self->idle_since != 0) {
+		self->idle_ticks += irt_time_ticks() - self->idle_since;
+		self->idle_since = 0;
+	}
+	#endif
+}
+
 void irt_worker_create(uint16 index, irt_affinity_mask affinity, irt_worker_init_signal* signal);
 void irt_worker_late_init(irt_worker* self);
 void _irt_worker_cancel_all_others();
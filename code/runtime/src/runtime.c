@@ -41,20 +41,61 @@
 #include "irt_all_impls.h"
 #include "standalone.h"
 
+#ifndef IRT_MIN_MODE
+
+static void _irt_runtime_print_usage() {
+	IRT_INFO("usage: runtime [-n numthreads] lib[:weight]...\n"
+	         "       runtime --submit lib[:weight]...\n"
+	         "  Starts a runtime service executing the given client applications on a shared pool of worker threads,\n"
+	         "  or submits applications to an already running service. Each application receives a share of the\n"
+	         "  workers proportional to its weight (default: %d).\n",
+	         IRT_TENANT_DEFAULT_WEIGHT);
+}
+
+// splits a "lib[:weight]" argument into library name and weight
+static uint32 _irt_runtime_parse_app(char* arg) {
+	char* sep = strrchr(arg, ':');
+	if(sep == NULL) { return IRT_TENANT_DEFAULT_WEIGHT; }
+	*sep = '\0';
+	int weight = atoi(sep + 1);
+	return weight > 0 ? (uint32)weight : IRT_TENANT_DEFAULT_WEIGHT;
+}
+
+static void _irt_runtime_submit_apps(int first, int argc, char** argv) {
+	for(int i = first; i < argc; ++i) {
+		uint32 weight = _irt_runtime_parse_app(argv[i]);
+		IRT_DEBUG("Sending new app msg for %s (weight %u)", argv[i], weight);
+		irt_mqueue_send_new_app(argv[i], weight);
+	}
+}
+
+#endif // IRT_MIN_MODE
+
 int main(int argc, char** argv) {
 #ifndef IRT_MIN_MODE
-	if(argc < 2 || argc > 3) {
-		IRT_INFO("usage: runtime [libname] [numthreads]\n");
-		return -1;
+	if(argc >= 2 && strcmp(argv[1], "--submit") == 0) {
+		if(argc < 3) {
+			_irt_runtime_print_usage();
+			return -1;
+		}
+		irt_mqueue_connect();
+		_irt_runtime_submit_apps(2, argc, argv);
+		return 0;
 	}
 
-	uint32 worker_count = 1;
-	if(argc >= 3) { worker_count = atoi(argv[2]); }
-	irt_runtime_start(IRT_RT_MQUEUE, worker_count);
+	uint32 worker_count = irt_get_default_worker_count();
+	int first_app = 1;
+	if(argc >= 3 && strcmp(argv[1], "-n") == 0) {
+		worker_count = atoi(argv[2]);
+		first_app = 3;
+	}
+	if(worker_count == 0 || first_app >= argc) {
+		_irt_runtime_print_usage();
+		return -1;
+	}
 
-	IRT_DEBUG("Sending new app msg");
-	irt_mqueue_send_new_app(argv[1]);
-	IRT_DEBUG("New app msg sent");
+	irt_runtime_start_service(worker_count);
+	_irt_runtime_submit_apps(first_app, argc, argv);
 
 	for(;;) {
 		irt_nanosleep(60 * 60 * 1e9);
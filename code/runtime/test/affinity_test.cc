@@ -119,6 +119,109 @@ TEST(affinity, maxdist) {
 	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(7, pol), 6));
 }
 
+// sets up 2 sockets x 2 cores x 2 hardware threads, numbered like Linux does (SMT siblings are cpu n and n+4)
+void setup_test_topology() {
+	_irt_hw_set_num_cpus(8);
+	irt_g_affinity_topology.num_cpus = 8;
+	for(uint32 i = 0; i < 8; ++i) {
+		irt_g_affinity_topology.cpus[i].socket = (i % 4) / 2;
+		irt_g_affinity_topology.cpus[i].core = i % 4;
+		irt_g_affinity_topology.cpus[i].smt = i / 4;
+	}
+}
+
+TEST(affinity, compact) {
+	setup_test_topology();
+	irt_g_worker_count = 8;
+
+	irt_affinity_policy pol;
+	pol.type = IRT_AFFINITY_COMPACT;
+	pol.reserved_cores = 0;
+	irt_affinity_policy_apply_topology(&pol);
+
+	EXPECT_EQ(8, pol.fixed_map_size);
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(0, pol), 0));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(1, pol), 4));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(2, pol), 1));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(3, pol), 5));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(4, pol), 2));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(5, pol), 6));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(6, pol), 3));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(7, pol), 7));
+	EXPECT_TRUE(irt_affinity_mask_is_empty(irt_affinity_get_reserved_mask(pol)));
+}
+
+TEST(affinity, physical_cores) {
+	setup_test_topology();
+	irt_g_worker_count = 4;
+
+	irt_affinity_policy pol;
+	pol.type = IRT_AFFINITY_PHYSICAL_CORES;
+	pol.reserved_cores = 0;
+	irt_affinity_policy_apply_topology(&pol);
+
+	EXPECT_EQ(4, pol.fixed_map_size);
+	for(int i = 0; i < 4; ++i) {
+		EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(i, pol), i));
+	}
+}
+
+TEST(affinity, scatter) {
+	setup_test_topology();
+	irt_affinity_policy pol;
+	pol.type = IRT_AFFINITY_SCATTER;
+	pol.reserved_cores = 0;
+
+	// two workers end up on different sockets
+	irt_g_worker_count = 2;
+	irt_affinity_policy_apply_topology(&pol);
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(0, pol), 0));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(1, pol), 2));
+
+	// four workers use every core of both sockets, neighboring ids share a socket
+	irt_g_worker_count = 4;
+	irt_affinity_policy_apply_topology(&pol);
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(0, pol), 0));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(1, pol), 1));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(2, pol), 2));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(3, pol), 3));
+
+	// six workers add SMT siblings of the first core of each socket
+	irt_g_worker_count = 6;
+	irt_affinity_policy_apply_topology(&pol);
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(0, pol), 0));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(1, pol), 1));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(2, pol), 4));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(3, pol), 2));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(4, pol), 3));
+	EXPECT_TRUE(irt_affinity_mask_is_single_cpu(irt_get_affinity(5, pol), 6));
+}
+
+TEST(affinity, reserved_cores) {
+	setup_test_topology();
+	irt_g_worker_count = 6;
+
+	irt_affinity_policy pol;
+	pol.type = IRT_AFFINITY_COMPACT;
+	pol.reserved_cores = 1;
+	irt_affinity_policy_apply_topology(&pol);
+
+	// the last core (cpus 3 and 7) is kept free for the maintenance thread
+	EXPECT_EQ(6, pol.fixed_map_size);
+	for(int i = 0; i < 6; ++i) {
+		EXPECT_NE(3, irt_affinity_mask_get_first_cpu(irt_get_affinity(i, pol)));
+		EXPECT_NE(7, irt_affinity_mask_get_first_cpu(irt_get_affinity(i, pol)));
+	}
+
+	irt_affinity_mask reserved = irt_affinity_get_reserved_mask(pol);
+	EXPECT_TRUE(irt_affinity_mask_is_set(reserved, 3));
+	EXPECT_TRUE(irt_affinity_mask_is_set(reserved, 7));
+	for(int i = 0; i < 3; ++i) {
+		EXPECT_FALSE(irt_affinity_mask_is_set(reserved, i));
+		EXPECT_FALSE(irt_affinity_mask_is_set(reserved, i + 4));
+	}
+}
+
 void* dummy_func(void* nada) {
 	printf("hello world");
 	return NULL;
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include <gtest/gtest.h>
+
+#include <irt_all_impls.h>
+#include <standalone.h>
+
+irt_dop_control_state make_state(uint32 min_dop, uint32 max_dop, uint32 cur_dop) {
+	irt_dop_control_state state;
+	memset(&state, 0, sizeof(state));
+	state.min_dop = min_dop;
+	state.max_dop = max_dop;
+	state.cur_dop = cur_dop;
+	state.last_dop = cur_dop;
+	return state;
+}
+
+#define MS (1000ull * 1000ull)
+
+TEST(dop_control, shrink_when_idle) {
+	irt_dop_control_state state = make_state(1, 8, 4);
+	// half of the time of 4 workers is spent idle
+	EXPECT_EQ(3, irt_dop_control_decide(&state, 100 * MS, 200 * MS, 0));
+	EXPECT_EQ(2, irt_dop_control_decide(&state, 100 * MS, 200 * MS, 0));
+	EXPECT_EQ(1, irt_dop_control_decide(&state, 100 * MS, 200 * MS, 0));
+	// the floor is never crossed
+	EXPECT_EQ(1, irt_dop_control_decide(&state, 100 * MS, 100 * MS, 0));
+}
+
+TEST(dop_control, grow_while_busy) {
+	irt_dop_control_state state = make_state(1, 3, 1);
+	EXPECT_EQ(2, irt_dop_control_decide(&state, 100 * MS, 0, 0));
+	EXPECT_EQ(3, irt_dop_control_decide(&state, 100 * MS, 0, 0));
+	// the ceiling is never crossed
+	EXPECT_EQ(3, irt_dop_control_decide(&state, 100 * MS, 0, 0));
+}
+
+TEST(dop_control, scaling_workload) {
+	irt_dop_control_state state = make_state(1, 8, 2);
+	// first sample only establishes the throughput baseline
+	EXPECT_EQ(3, irt_dop_control_decide(&state, 100 * MS, 0, 200));
+	// throughput grows with the number of workers, keep growing
+	EXPECT_EQ(4, irt_dop_control_decide(&state, 100 * MS, 0, 300));
+	EXPECT_EQ(5, irt_dop_control_decide(&state, 100 * MS, 0, 400));
+}
+
+TEST(dop_control, memory_bound_workload) {
+	irt_dop_control_state state = make_state(1, 8, 4);
+	EXPECT_EQ(5, irt_dop_control_decide(&state, 100 * MS, 0, 400));
+	// an additional worker does not increase throughput, revert
+	EXPECT_EQ(4, irt_dop_control_decide(&state, 100 * MS, 0, 400));
+	// hold the reverted degree of parallelism for a while
+	for(int i = 0; i < IRT_DOP_CONTROL_HOLD_SAMPLES; ++i) {
+		EXPECT_EQ(4, irt_dop_control_decide(&state, 100 * MS, 0, 400));
+	}
+	// then probe again
+	EXPECT_EQ(5, irt_dop_control_decide(&state, 100 * MS, 0, 400));
+}
+
+TEST(dop_control, shrink_without_loss) {
+	irt_dop_control_state state = make_state(1, 8, 6);
+	// establish baseline while idle, which shrinks
+	EXPECT_EQ(5, irt_dop_control_decide(&state, 100 * MS, 300 * MS, 500));
+	// same throughput with fewer workers, continue shrinking
+	EXPECT_EQ(4, irt_dop_control_decide(&state, 100 * MS, 0, 500));
+	EXPECT_EQ(3, irt_dop_control_decide(&state, 100 * MS, 0, 490));
+	// throughput drops significantly, go back
+	EXPECT_EQ(4, irt_dop_control_decide(&state, 100 * MS, 0, 300));
+}
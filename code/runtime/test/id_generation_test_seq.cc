@@ -60,3 +60,17 @@ TEST(id_generation, sequential_ops) {
 	EXPECT_EQ(test2.node, gen_id.node);
 	EXPECT_EQ(test2.index, test1.index + 1);
 }
+
+TEST(id_generation, range_reservation) {
+	gen_id.thread = 3;
+	gen_id.node = 1;
+
+	irt_id_gen_test_id first = irt_generate_id_gen_test_id_range(&gen_id, 16);
+	EXPECT_EQ(first.thread, gen_id.thread);
+	EXPECT_EQ(first.node, gen_id.node);
+	EXPECT_EQ(first.index + 16, gen_id.index);
+
+	// the next id follows the reserved range
+	irt_id_gen_test_id next = irt_generate_id_gen_test_id(&gen_id);
+	EXPECT_EQ(first.index + 16, next.index);
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include <gtest/gtest.h>
+
+#include <irt_all_impls.h>
+#include <standalone.h>
+
+#define NUM_WORKERS 8
+
+void tenant_test_context_fun(irt_context* c) {
+	c->impl_table_size = 0;
+	c->info_table_size = 0;
+	c->type_table_size = 0;
+	c->num_regions = 0;
+}
+
+TEST(tenants, weighted_partition) {
+	irt_context* context = irt_runtime_start_in_context(NUM_WORKERS, &tenant_test_context_fun, &tenant_test_context_fun, false);
+	uint32 first, count;
+
+	// contexts which are no tenants use the whole pool
+	irt_context_get_worker_share(context->id, &first, &count);
+	EXPECT_EQ(0, first);
+	EXPECT_EQ(NUM_WORKERS, count);
+
+	irt_context* a = irt_context_create_standalone(&tenant_test_context_fun, &tenant_test_context_fun);
+	irt_context* b = irt_context_create_standalone(&tenant_test_context_fun, &tenant_test_context_fun);
+
+	irt_context_add_tenant(a, 3);
+	EXPECT_EQ(0, a->first_worker);
+	EXPECT_EQ(NUM_WORKERS, a->num_workers);
+
+	// 3:1 => 6 and 2 workers, contiguous and disjoint
+	irt_context_add_tenant(b, 1);
+	EXPECT_EQ(0, a->first_worker);
+	EXPECT_EQ(6, a->num_workers);
+	EXPECT_EQ(6, b->first_worker);
+	EXPECT_EQ(2, b->num_workers);
+	irt_context_get_worker_share(b->id, &first, &count);
+	EXPECT_EQ(6, first);
+	EXPECT_EQ(2, count);
+
+	// workers only share work within their tenant
+	EXPECT_EQ(0, irt_g_workers[5]->share_first);
+	EXPECT_EQ(6, irt_g_workers[5]->share_count);
+	EXPECT_EQ(6, irt_g_workers[7]->share_first);
+	EXPECT_EQ(2, irt_g_workers[7]->share_count);
+
+	// the remaining tenant gets the whole pool back
+	irt_context_remove_tenant(a);
+	EXPECT_EQ(0, b->first_worker);
+	EXPECT_EQ(NUM_WORKERS, b->num_workers);
+
+	irt_context_remove_tenant(b);
+	EXPECT_EQ(0, irt_g_workers[7]->share_first);
+	EXPECT_EQ(NUM_WORKERS, irt_g_workers[7]->share_count);
+
+	irt_context_destroy(a);
+	irt_context_destroy(b);
+	irt_runtime_end_in_context(context);
+}
+
+TEST(tenants, every_tenant_gets_a_worker) {
+	irt_context* context = irt_runtime_start_in_context(2, &tenant_test_context_fun, &tenant_test_context_fun, false);
+
+	irt_context* tenants[3];
+	uint32 weights[3] = {100, 1, 1};
+	for(int i = 0; i < 3; ++i) {
+		tenants[i] = irt_context_create_standalone(&tenant_test_context_fun, &tenant_test_context_fun);
+		irt_context_add_tenant(tenants[i], weights[i]);
+	}
+	for(int i = 0; i < 3; ++i) {
+		EXPECT_GE(tenants[i]->num_workers, 1u);
+		EXPECT_LE(tenants[i]->first_worker + tenants[i]->num_workers, 2u);
+	}
+	for(int i = 0; i < 3; ++i) {
+		irt_context_remove_tenant(tenants[i]);
+		irt_context_destroy(tenants[i]);
+	}
+	irt_runtime_end_in_context(context);
+}
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include <gtest/gtest.h>
+#include "standalone.h"
+
+#define NUM_MEMBERS 8
+#define NUM_VALUES 64
+
+// parameters too large for the inline buffer of a work item
+typedef struct _large_params {
+	irt_type_id type_id;
+	uint64 values[NUM_VALUES];
+	irt_lw_data_item** seen;
+} large_params;
+
+void param_test_parallel(irt_work_item* wi);
+void param_test_parallel_member(irt_work_item* wi);
+void param_test_batch(irt_work_item* wi);
+
+irt_wi_implementation_variant g_param_test_parallel_variants[] = {{&param_test_parallel}};
+irt_wi_implementation_variant g_param_test_parallel_member_variants[] = {{&param_test_parallel_member}};
+irt_wi_implementation_variant g_param_test_batch_variants[] = {{&param_test_batch}};
+
+irt_wi_implementation g_param_test_impl_table[] = {
+    {0, 1, g_param_test_parallel_variants}, {1, 1, g_param_test_parallel_member_variants}, {2, 1, g_param_test_batch_variants},
+};
+
+void param_test_init_context(irt_context* context) {
+	context->type_table_size = 0;
+	context->impl_table_size = 3;
+	context->impl_table = g_param_test_impl_table;
+	context->num_regions = 0;
+}
+
+void param_test_cleanup_context(irt_context* context) {}
+
+void param_test_fill(large_params* params, irt_lw_data_item** seen) {
+	params->type_id = -((int32)sizeof(large_params));
+	for(int i = 0; i < NUM_VALUES; ++i) {
+		params->values[i] = i * 3;
+	}
+	params->seen = seen;
+}
+
+void param_test_check(irt_work_item* wi, uint32 index) {
+	large_params* params = (large_params*)wi->parameters;
+	for(int i = 0; i < NUM_VALUES; ++i) {
+		EXPECT_EQ(i * 3, params->values[i]);
+	}
+	params->seen[index] = wi->parameters;
+}
+
+void param_test_parallel_member(irt_work_item* wi) {
+	param_test_check(wi, irt_wi_get_wg_num(wi, 0));
+}
+
+void param_test_parallel(irt_work_item* wi) {
+	irt_lw_data_item* seen[NUM_MEMBERS] = {NULL};
+	large_params params;
+	param_test_fill(&params, seen);
+	irt_parallel_job job = {NUM_MEMBERS, NUM_MEMBERS, 1, &g_param_test_impl_table[1], (irt_lw_data_item*)&params};
+	irt_merge(irt_parallel(&job));
+
+	// all members reference the same copy of the parameters
+	EXPECT_NE((irt_lw_data_item*)&params, seen[0]);
+	for(int i = 1; i < NUM_MEMBERS; ++i) {
+		EXPECT_EQ(seen[0], seen[i]);
+	}
+}
+
+void param_test_batch(irt_work_item* wi) {
+	irt_lw_data_item* seen[NUM_MEMBERS] = {NULL};
+	large_params params;
+	param_test_fill(&params, seen);
+	irt_work_item* wis[NUM_MEMBERS];
+	irt_wi_create_batch(NUM_MEMBERS, irt_g_wi_range_one_elem, &g_param_test_impl_table[1], (irt_lw_data_item*)&params, wis);
+	irt_work_group* group = irt_wg_create();
+	irt_wg_insert_batch(group, NUM_MEMBERS, wis);
+
+	EXPECT_EQ(NUM_MEMBERS, *wi->num_active_children);
+	EXPECT_EQ(NUM_MEMBERS, group->local_member_count);
+	for(int i = 0; i < NUM_MEMBERS; ++i) {
+		// consecutive ids and member numbers, a single shared copy of the parameters
+		EXPECT_EQ(wis[0]->id.index + i, wis[i]->id.index);
+		EXPECT_EQ(wi->id.full, wis[i]->parent_id.full);
+		EXPECT_EQ(i, irt_wi_get_wg_num(wis[i], 0));
+		EXPECT_EQ(wis[0]->param_block, wis[i]->param_block);
+	}
+	EXPECT_EQ(NUM_MEMBERS, wis[0]->param_block->ref_count);
+
+	for(int i = 0; i < NUM_MEMBERS; ++i) {
+		irt_scheduling_assign_wi(irt_worker_get_current(), wis[i]);
+	}
+	irt_wg_join(group->id);
+	for(int i = 0; i < NUM_MEMBERS; ++i) {
+		EXPECT_EQ(seen[0], seen[i]);
+	}
+}
+
+TEST(wi_param_block, shared_by_parallel_members) {
+	irt_runtime_standalone(irt_get_default_worker_count(), &param_test_init_context, &param_test_cleanup_context, &g_param_test_impl_table[0], NULL);
+}
+
+TEST(wi_param_block, batch_creation) {
+	irt_runtime_standalone(irt_get_default_worker_count(), &param_test_init_context, &param_test_cleanup_context, &g_param_test_impl_table[2], NULL);
+}
+
+TEST(wi_param_block, reference_counting) {
+	large_params params;
+	param_test_fill(&params, NULL);
+	irt_wi_param_block* block = irt_wi_param_block_create(NULL, (irt_lw_data_item*)&params);
+	EXPECT_EQ(1, block->ref_count);
+	EXPECT_EQ(0, memcmp(&params, block->params, sizeof(large_params)));
+	irt_wi_param_block_retain(block);
+	EXPECT_EQ(2, block->ref_count);
+	irt_wi_param_block_release(block);
+	EXPECT_EQ(1, block->ref_count);
+	irt_wi_param_block_release(block);
+}
@@ -41,6 +41,7 @@
 #include "insieme/transform/transformation.h"
 
 #include "insieme/core/pattern/rule.h"
+#include "insieme/core/pattern/rule_set.h"
 
 namespace insieme {
 namespace transform {
@@ -50,13 +51,13 @@ namespace rulebased {
 	 * A class realizing a transformation based on a set of transformation rules.
 	 * The list of rules is scanned until one of the rules is matching. The transformed
 	 * code will then be returned. If no rule is matching, no transformation will
-	 * be applied.
+	 * be applied. Rules which can not match the type of the target node are skipped.
 	 */
 	class RuleBasedTransformation : public Transformation {
 		/**
 		 * The set of rules to be tested.
 		 */
-		vector<core::pattern::Rule> rules;
+		core::pattern::RuleSet rules;
 
 	  public:
 		/**
@@ -91,7 +92,7 @@ namespace rulebased {
 		 * Obtains a reference to the internally used rules.
 		 */
 		const vector<core::pattern::Rule>& getRules() const {
-			return rules;
+			return rules.getRules();
 		}
 	};
 
@@ -71,10 +71,8 @@ namespace rulebased {
 
 	core::NodeAddress RuleBasedTransformation::apply(const core::NodeAddress& target) const {
 		// the first matching rule will be applied
-		for(auto it = rules.begin(); it != rules.end(); ++it) {
-			core::NodePtr res = it->applyTo(target);
-			if(res) { return core::transform::replaceAddress(target->getNodeManager(), target, res); }
-		}
+		core::NodePtr res = rules.applyTo(target);
+		if(res) { return core::transform::replaceAddress(target->getNodeManager(), target, res); }
 		throw InvalidTargetException(target);
 	}
 
@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/utility.hpp>
+
+#include "insieme/utils/assert.h"
+
+namespace insieme {
+namespace utils {
+
+	/**
+	 * A simple bump-pointer allocator handing out memory from large blocks. Memory obtained
+	 * from an arena can not be released individually - all of it is freed at once when the
+	 * arena is destroyed. Objects placed within an arena have to be destructed explicitly.
+	 *
+	 * Allocations are thread safe.
+	 */
+	class Arena : private boost::noncopyable {
+		/**
+		 * The default size of the blocks requested from the system.
+		 */
+		static const std::size_t default_block_size = 64 * 1024;
+
+		/**
+		 * The lock protecting the internal state.
+		 */
+		mutable std::mutex lock;
+
+		/**
+		 * The blocks allocated so far.
+		 */
+		std::vector<std::unique_ptr<char[]>> blocks;
+
+		/**
+		 * The next free position within the current block.
+		 */
+		char* cur = nullptr;
+
+		/**
+		 * The end of the current block.
+		 */
+		char* end = nullptr;
+
+		/**
+		 * The total number of bytes handed out by this arena.
+		 */
+		std::size_t allocated = 0;
+
+		/**
+		 * The total number of bytes reserved for the blocks of this arena.
+		 */
+		std::size_t reserved = 0;
+
+		char* newBlock(std::size_t size) {
+			blocks.emplace_back(new char[size]);
+			reserved += size;
+			return blocks.back().get();
+		}
+
+	  public:
+		/**
+		 * Obtains a piece of memory of the given size and alignment from this arena.
+		 *
+		 * @param size the number of bytes requested
+		 * @param alignment the requested alignment, has to be a power of 2 not exceeding the one of std::max_align_t
+		 * @return a pointer to the requested memory, valid until this arena is destroyed
+		 */
+		void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) {
+			assert_true(alignment > 0 && (alignment & (alignment - 1)) == 0) << "Alignment must be a power of 2!";
+			assert_le(alignment, alignof(std::max_align_t)) << "Over-aligned allocations are not supported!";
+
+			std::lock_guard<std::mutex> guard(lock);
+			allocated += size;
+
+			// large requests are served by a dedicated block
+			if(size > default_block_size / 4) { return newBlock(size); }
+
+			// align the current position
+			std::uintptr_t pos = reinterpret_cast<std::uintptr_t>(cur);
+			char* res = cur + ((alignment - pos % alignment) % alignment);
+
+			// start a new block if the current one is exhausted
+			if(!cur || res + size > end) {
+				res = newBlock(default_block_size);
+				end = res + default_block_size;
+			}
+
+			cur = res + size;
+			return res;
+		}
+
+		/**
+		 * Obtains the total number of bytes handed out by this arena.
+		 */
+		std::size_t getAllocatedBytes() const {
+			std::lock_guard<std::mutex> guard(lock);
+			return allocated;
+		}
+
+		/**
+		 * Obtains the total number of bytes reserved by this arena, including unused
+		 * space at the end of blocks.
+		 */
+		std::size_t getReservedBytes() const {
+			std::lock_guard<std::mutex> guard(lock);
+			return reserved;
+		}
+
+		/**
+		 * Obtains the number of blocks requested from the system.
+		 */
+		std::size_t getNumBlocks() const {
+			std::lock_guard<std::mutex> guard(lock);
+			return blocks.size();
+		}
+	};
+
+} // end namespace utils
+} // end namespace insieme
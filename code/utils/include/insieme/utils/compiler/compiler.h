@@ -165,6 +165,18 @@ namespace compiler {
 	 */
 	bool compile(const vector<string>& sourcefiles, const string& targetfile, const Compiler& compiler = Compiler::getDefaultC99Compiler());
 
+	/**
+	 * Compiles the given source files independently of each other using up to the given number of concurrent compiler
+	 * processes and links the resulting object files into the given target file.
+	 *
+	 * @param sourcefiles the files to be compiled, each forming a translation unit of its own
+	 * @param targetfile the file to be produced
+	 * @param compiler the compiler to be used for the compilation and linking
+	 * @param numThreads the maximum number of concurrent compiler processes, 0 to use all available cores
+	 * @return true if successful, false otherwise
+	 */
+	bool compileInParallel(const vector<string>& sourcefiles, const string& targetfile, const Compiler& compiler, unsigned numThreads = 0);
+
 	/**
 	 * Compiles the given source file using the defined compiler (by default, it is the default C compiler) and
 	 * writes the resulting binary into the given target file.
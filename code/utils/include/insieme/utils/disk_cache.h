@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/optional.hpp>
+
+#include "insieme/utils/printable.h"
+
+namespace insieme {
+namespace utils {
+namespace cache {
+
+	/**
+	 * A persistent cache mapping string keys to string values, stored within a directory of the
+	 * file system. Every entry is stored within a file of its own, named by a digest of its key.
+	 * The full key is stored along with the value, such that colliding digests are detected. New
+	 * entries are written to temporary files and moved in place afterwards, such that concurrent
+	 * processes and threads may safely share a cache directory.
+	 */
+	class DiskCache : public Printable {
+		/**
+		 * The directory holding the cache entries.
+		 */
+		boost::filesystem::path directory;
+
+		/**
+		 * The number of successful and unsuccessful lookups and the number of stored entries.
+		 */
+		std::atomic<unsigned> hits;
+		std::atomic<unsigned> misses;
+		std::atomic<unsigned> stores;
+
+	  public:
+		/**
+		 * Creates a cache maintaining its entries within the given directory, which is created if necessary.
+		 *
+		 * @param directory the directory to store the cache entries in
+		 */
+		DiskCache(const boost::filesystem::path& directory);
+
+		/**
+		 * Obtains the cache shared by all compilation steps, located in the directory specified by the
+		 * INSIEME_CACHE_DIR environment variable.
+		 *
+		 * @return a pointer to the cache or null if no cache directory has been specified
+		 */
+		static DiskCache* getDefault();
+
+		/**
+		 * Computes a digest of the given data suitable for forming cache keys. The digest is stable
+		 * across executions and platforms.
+		 *
+		 * @param data the data to be digested
+		 * @return a hexadecimal representation of the digest
+		 */
+		static std::string getDigest(const std::string& data);
+
+		/**
+		 * Looks up the value stored for the given key.
+		 *
+		 * @param key the key to be looked up
+		 * @param isValid an optional filter for values which are no longer valid, counted as misses
+		 * @return the stored value, if present and valid
+		 */
+		boost::optional<std::string> lookup(const std::string& key, const std::function<bool(const std::string&)>& isValid = nullptr);
+
+		/**
+		 * Stores the given value for the given key, replacing any previously stored value.
+		 *
+		 * @param key the key of the value to be stored
+		 * @param value the value to be stored
+		 */
+		void store(const std::string& key, const std::string& value);
+
+		/**
+		 * Obtains the directory holding the cache entries.
+		 */
+		const boost::filesystem::path& getDirectory() const {
+			return directory;
+		}
+
+		unsigned getNumHits() const {
+			return hits;
+		}
+
+		unsigned getNumMisses() const {
+			return misses;
+		}
+
+		unsigned getNumStores() const {
+			return stores;
+		}
+
+		/**
+		 * Prints the usage statistics of this cache.
+		 */
+		std::ostream& printTo(std::ostream& out) const;
+
+	  private:
+		boost::filesystem::path getEntryFile(const std::string& key) const;
+	};
+
+} // end namespace cache
+} // end namespace utils
+} // end namespace insieme
@@ -38,18 +38,22 @@
 #pragma once
 
 #include <algorithm>
-#include <unordered_set>
+#include <array>
 #include <functional>
+#include <mutex>
 
 #include <iostream>
 
 #include <boost/functional/hash.hpp>
+#include <boost/unordered_set.hpp>
 #include <boost/type_traits/is_base_of.hpp>
 #include <boost/type_traits/is_const.hpp>
 #include <boost/utility/enable_if.hpp>
 #include <boost/utility.hpp>
+#include <boost/iterator/iterator_facade.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 
+#include "insieme/utils/arena.h"
 #include "insieme/utils/pointer.h"
 #include "insieme/utils/container_utils.h"
 #include "insieme/utils/functional_utils.h"
@@ -66,6 +70,18 @@ struct no_post_add_action {
 	}
 };
 
+/**
+ * A functor releasing instances owned by an instance manager. By default, instances are
+ * assumed to be allocated on the heap. Types placing their clones within the arena of the
+ * managing instance manager have to specialize this functor to only destruct them.
+ */
+template <typename T>
+struct instance_disposal {
+	void operator()(const T* instance) const {
+		delete instance;
+	}
+};
+
 /**
  * An instance manager is capable of handling a set of instances of a generic type T. Instances
  * representing the same value are shared. Hence, to avoid altering the instances referenced by
@@ -74,6 +90,11 @@ struct no_post_add_action {
  * Instance managers can be chained to form hierarchies of sharing domains. The derived manager
  * extends the base manager and thereby "inherits" all elements.
  *
+ * Adding and looking up instances is thread safe. To keep contention low, the internal storage
+ * is split into shards selected by the hash of the instances, each protected by its own lock.
+ * Base managers must not be extended while derived managers are used concurrently. Iterating
+ * over the elements of a manager is not synchronized with concurrent insertions.
+ *
  * @tparam T the type of elements managed by the concrete manager instance. The type has to
  * 			 be a constant type.
  */
@@ -85,15 +106,82 @@ class InstanceManager : private boost::noncopyable {
 	/**
 	 * The type of storage used internally.
 	 */
-	typedef std::unordered_set<const T*, hash_target<const T*>, equal_target<const T*>> storage_type;
+	typedef boost::unordered_set<const T*, hash_target<const T*>, equal_target<const T*>> storage_type;
+
+	/**
+	 * The number of shards the storage is split into.
+	 */
+	static const std::size_t num_shards = 32;
+
+	/**
+	 * A shard of the storage, consisting of an unordered set which is modified to support
+	 * operations based on pointers and the lock protecting it.
+	 */
+	struct Shard {
+		mutable std::mutex lock;
+		storage_type elements;
+	};
+
+	/**
+	 * An arena which may be used for allocating the instances owned by this manager. It is
+	 * released after all the instances have been disposed.
+	 */
+	insieme::utils::Arena arena;
 
 	/**
-	 * The storage used to maintain instances. It is based on a unordered set which
-	 * is modified to support operations based on pointers. All the elements stored
-	 * within this set will be automatically deleted when this instance manager instance
-	 * is destroyed.
+	 * The storage used to maintain instances. All the elements stored within the shards
+	 * will be automatically deleted when this instance manager instance is destroyed.
 	 */
-	storage_type storage;
+	std::array<Shard, num_shards> shards;
+
+	/**
+	 * Obtains the shard responsible for maintaining the given instance (or any equivalent one).
+	 */
+	Shard& getShard(const T* instance) {
+		return shards[getShardIndex(instance)];
+	}
+
+	const Shard& getShard(const T* instance) const {
+		return shards[getShardIndex(instance)];
+	}
+
+	static std::size_t getShardIndex(const T* instance) {
+		static const hash_target<const T*> hasher = hash_target<const T*>();
+		return getShardIndex(hasher(instance));
+	}
+
+	static std::size_t getShardIndex(std::size_t hash) {
+		// mix in upper bits, the lower ones are used by the sets within the shards
+		return (hash ^ (hash >> 17)) % num_shards;
+	}
+
+	/**
+	 * A key type for looking up instances based on their hash and a predicate
+	 * instead of an instance.
+	 */
+	template <typename Predicate>
+	struct PredicateKey {
+		std::size_t hash;
+		const Predicate& pred;
+	};
+
+	struct PredicateKeyHash {
+		template <typename Predicate>
+		std::size_t operator()(const PredicateKey<Predicate>& key) const {
+			return key.hash;
+		}
+	};
+
+	struct PredicateKeyEqual {
+		template <typename Predicate>
+		bool operator()(const PredicateKey<Predicate>& key, const T* instance) const {
+			return key.pred(*instance);
+		}
+		template <typename Predicate>
+		bool operator()(const T* instance, const PredicateKey<Predicate>& key) const {
+			return key.pred(*instance);
+		}
+	};
 
 	/**
 	 * The base manager of this manager, null if not present. This field is realizing
@@ -137,8 +225,12 @@ class InstanceManager : private boost::noncopyable {
 	 * The destructor of this instance manager freeing all elements within the store.
 	 */
 	virtual ~InstanceManager() {
-		// delete all elements maintained by the manager
-		std::for_each(storage.begin(), storage.end(), [](const T* cur) { delete cur; });
+		static const instance_disposal<T> dispose = instance_disposal<T>();
+
+		// dispose all elements maintained by the manager
+		for(Shard& shard : shards) {
+			std::for_each(shard.elements.begin(), shard.elements.end(), [](const T* cur) { dispose(cur); });
+		}
 	}
 
 	/**
@@ -150,6 +242,20 @@ class InstanceManager : private boost::noncopyable {
 		return base;
 	}
 
+	/**
+	 * Obtains the arena to be used for allocating instances owned by this manager.
+	 */
+	insieme::utils::Arena& getArena() {
+		return arena;
+	}
+
+	/**
+	 * Obtains the arena to be used for allocating instances owned by this manager.
+	 */
+	const insieme::utils::Arena& getArena() const {
+		return arena;
+	}
+
 	/**
 	 * Adds the given instance to this manager if not already present.
 	 *
@@ -174,19 +280,31 @@ class InstanceManager : private boost::noncopyable {
 			return std::make_pair(R<const S>(dynamic_cast<const S*>(res)), false);
 		}
 
-		// clone element (to ensure private copy)
+		// clone element (to ensure private copy) - no lock may be held while doing so since
+		// cloning is recursively adding the sub-structures of the instance to this manager
 		const S* newElement = clone(instance);
 
-		__insieme_unused auto check = storage.insert(newElement);
-
 		// ensure this is a clone
 		assert_ne(instance, newElement);
 
-		// ensure the element has really been added (hash and equals is properly implemented)
-		assert_true(*check.first == newElement || check.second);
+		Shard& shard = getShard(instance);
+		std::unique_lock<std::mutex> guard(shard.lock);
+
+		auto check = shard.elements.insert(newElement);
 
 		// ensure the element can be found again
-		assert_true(check.first == storage.find(instance)) << "Unable to add clone - value already present!";
+		assert_true(check.first == shard.elements.find(instance)) << "Unable to add clone - value already present!";
+
+		if(!check.second && *check.first != newElement) {
+			// another thread has added an equivalent element in the meantime => use this one
+			const T* winner = *check.first;
+			guard.unlock();
+			static const instance_disposal<T> dispose = instance_disposal<T>();
+			dispose(newElement);
+			lookupAction(instance, winner);
+			return std::make_pair(R<const S>(dynamic_cast<const S*>(winner)), false);
+		}
+		guard.unlock();
 
 		// apply post-insert action
 		postAddAction(instance, newElement);
@@ -310,8 +428,10 @@ class InstanceManager : private boost::noncopyable {
 		}
 
 		// check local storage
-		auto res = storage.find(instance);
-		if(res != storage.end()) {
+		const Shard& shard = getShard(instance);
+		std::lock_guard<std::mutex> guard(shard.lock);
+		auto res = shard.elements.find(instance);
+		if(res != shard.elements.end()) {
 			// found locally
 			return static_cast<const S*>(*res);
 		}
@@ -321,6 +441,34 @@ class InstanceManager : private boost::noncopyable {
 		return NULL;
 	}
 
+	/**
+	 * Looks up an instance within this manager (including its base manager) based on its hash value
+	 * and a predicate identifying the requested instance. Unlike the other lookup operations, this
+	 * one does not require an instance equivalent to the requested one to be materialized.
+	 *
+	 * @tparam Predicate the type of predicate to be utilized, accepting a const T&
+	 * @param hash the hash value the requested instance would have
+	 * @param pred a predicate accepting only instances equivalent to the requested one
+	 * @return a pointer to the internally maintained instance or NULL if not found
+	 */
+	template <typename Predicate>
+	const T* lookupPlain(std::size_t hash, const Predicate& pred) const {
+		// first, check whether there is an instance within the base manager
+		if(base) {
+			auto res = base->lookupPlain(hash, pred);
+			if(res) { return res; }
+		}
+
+		// check local storage
+		const Shard& shard = shards[getShardIndex(hash)];
+		std::lock_guard<std::mutex> guard(shard.lock);
+		auto res = shard.elements.find(PredicateKey<Predicate>{hash, pred}, PredicateKeyHash(), PredicateKeyEqual());
+		if(res != shard.elements.end()) { return *res; }
+
+		// not found => return null
+		return NULL;
+	}
+
 	/**
 	 * Looks up the given instance within this manager. If found, a corresponding
 	 * pointer will be returned. Otherwise, the retrieved pointer will point to NULL.
@@ -410,7 +558,22 @@ class InstanceManager : private boost::noncopyable {
 	 */
 	template <class S>
 	bool contains(const S* element) const {
-		return element == NULL || storage.find(element) != storage.cend() || (base && base->contains(element));
+		return element == NULL || containsLocal(element) || (base && base->contains(element));
+	}
+
+	/**
+	 * Checks whether a clone or the referenced element itself is present within
+	 * the local storage of this instance manager, ignoring the base manager.
+	 *
+	 * @tparam S the type of the element to be looking for
+	 * @param element the element to be looking for
+	 * @return true if present, false otherwise
+	 */
+	template <class S>
+	bool containsLocal(const S* element) const {
+		const Shard& shard = getShard(element);
+		std::lock_guard<std::mutex> guard(shard.lock);
+		return shard.elements.find(element) != shard.elements.cend();
 	}
 
 	/**
@@ -485,8 +648,10 @@ class InstanceManager : private boost::noncopyable {
 		if(!ptr) { return true; }
 
 		// check whether a corresponding element is present
-		auto local = storage.find(&*ptr);
-		if(local == storage.cend()) {
+		const Shard& shard = getShard(&*ptr);
+		std::lock_guard<std::mutex> guard(shard.lock);
+		auto local = shard.elements.find(&*ptr);
+		if(local == shard.elements.cend()) {
 			// not present => not local
 			return false;
 		}
@@ -527,12 +692,59 @@ class InstanceManager : private boost::noncopyable {
 	 * @return the total number of elements currently managed
 	 */
 	std::size_t size() const {
-		return storage.size();
+		std::size_t res = 0;
+		for(const Shard& shard : shards) {
+			std::lock_guard<std::mutex> guard(shard.lock);
+			res += shard.elements.size();
+		}
+		return res;
 	}
 
 	// --- offer an iterator over all elements within this instance manager ---
 
   private:
+	/**
+	 * An iterator enumerating the elements of all shards of the storage.
+	 */
+	class storage_iterator : public boost::iterator_facade<storage_iterator, const T* const, boost::forward_traversal_tag> {
+		const Shard* cur;
+		const Shard* last;
+		typename storage_type::const_iterator pos;
+
+	  public:
+		storage_iterator() : cur(nullptr), last(nullptr), pos() {}
+
+		storage_iterator(const Shard* begin, const Shard* end) : cur(begin), last(end), pos() {
+			if(cur != last) {
+				pos = cur->elements.begin();
+				skipEmpty();
+			}
+		}
+
+	  private:
+		friend class boost::iterator_core_access;
+
+		void skipEmpty() {
+			while(cur != last && pos == cur->elements.end()) {
+				++cur;
+				if(cur != last) { pos = cur->elements.begin(); }
+			}
+		}
+
+		void increment() {
+			++pos;
+			skipEmpty();
+		}
+
+		bool equal(const storage_iterator& other) const {
+			return cur == other.cur && (cur == last || pos == other.pos);
+		}
+
+		const T* const& dereference() const {
+			return *pos;
+		}
+	};
+
 	/**
 	 * A functor required for realizing a transforming iterator. This functor
 	 * is simply wrapping a pointer to some internally maintained data element
@@ -550,7 +762,7 @@ class InstanceManager : private boost::noncopyable {
 	 * The type of constant iterator offered by an instance manager to iterate over
 	 * all contained elements.
 	 */
-	typedef boost::transform_iterator<PtrWrapper, typename storage_type::const_iterator> const_iterator;
+	typedef boost::transform_iterator<PtrWrapper, storage_iterator> const_iterator;
 
 	/**
 	 * Obtains an iterator referencing the first element maintained by this instance
@@ -562,7 +774,7 @@ class InstanceManager : private boost::noncopyable {
 	 * @return a reference to the first element stored internally
 	 */
 	const_iterator begin() const {
-		return boost::make_transform_iterator<PtrWrapper>(storage.begin());
+		return boost::make_transform_iterator<PtrWrapper>(storage_iterator(shards.data(), shards.data() + num_shards));
 	}
 
 	/**
@@ -575,6 +787,6 @@ class InstanceManager : private boost::noncopyable {
 	 * @return a reference to the end element referencing the end of the internally stored nodes
 	 */
 	const_iterator end() const {
-		return boost::make_transform_iterator<PtrWrapper>(storage.end());
+		return boost::make_transform_iterator<PtrWrapper>(storage_iterator(shards.data() + num_shards, shards.data() + num_shards));
 	}
 };
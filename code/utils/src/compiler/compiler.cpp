@@ -41,6 +41,9 @@
 #include <cstdlib>
 #include <fstream>
 #include <sstream>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 #include <boost/filesystem.hpp>
 
@@ -239,6 +242,51 @@ namespace compiler {
 		return compile(files, targetfile, compiler);
 	}
 
+	bool compileInParallel(const vector<string>& sourcefiles, const string& targetfile, const Compiler& compiler, unsigned numThreads) {
+		// a single file does not need separate compilation and linking steps
+		if(sourcefiles.size() <= 1) { return compile(sourcefiles, targetfile, compiler); }
+
+		if(numThreads == 0) { numThreads = std::max(std::thread::hardware_concurrency(), 1u); }
+		numThreads = std::min<unsigned>(numThreads, sourcefiles.size());
+
+		// compile the individual files to object files
+		Compiler objCompiler = compiler;
+		objCompiler.addFlag("-c");
+
+		vector<string> objects;
+		for(std::size_t i = 0; i < sourcefiles.size(); i++) {
+			objects.push_back(fs::unique_path(fs::temp_directory_path() / "insieme-obj-%%%%%%%%.o").string());
+		}
+
+		std::atomic<bool> success(true);
+		auto run = [&](unsigned first) {
+			for(std::size_t i = first; i < sourcefiles.size(); i += numThreads) {
+				if(!compile(sourcefiles[i], objects[i], objCompiler)) { success = false; }
+			}
+		};
+		vector<std::thread> threads;
+		for(unsigned i = 0; i < numThreads; i++) {
+			threads.emplace_back(run, i);
+		}
+		for(auto& cur : threads) {
+			cur.join();
+		}
+
+		// link the object files - the language selection (-x) must not be applied to them
+		if(success) {
+			Compiler linker = compiler;
+			linker.addFlag("-x none");
+			success = compile(objects, targetfile, linker);
+		}
+
+		// clean up object files
+		for(const auto& cur : objects) {
+			if(fs::exists(cur)) { fs::remove(cur); }
+		}
+
+		return success;
+	}
+
 	string compile(const string& sourcefile, const Compiler& compiler) {
 		auto targetFile = getTemporaryFile();
 		if (compile(sourcefile, targetFile.string(), compiler)) {
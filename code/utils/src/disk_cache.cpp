@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include "insieme/utils/disk_cache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+
+#include "insieme/common/env_vars.h"
+
+namespace insieme {
+namespace utils {
+namespace cache {
+
+	namespace fs = boost::filesystem;
+
+	DiskCache::DiskCache(const fs::path& directory) : directory(directory), hits(0), misses(0), stores(0) {
+		fs::create_directories(directory);
+	}
+
+	DiskCache* DiskCache::getDefault() {
+		static std::unique_ptr<DiskCache> instance = []() -> std::unique_ptr<DiskCache> {
+			auto dir = getenv(INSIEME_CACHE_DIR);
+			if(!dir || !*dir) { return nullptr; }
+			return std::unique_ptr<DiskCache>(new DiskCache(dir));
+		}();
+		return instance.get();
+	}
+
+	std::string DiskCache::getDigest(const std::string& data) {
+		// two 64-bit FNV-1a hashes with different offsets - sufficient for digesting cache keys
+		uint64_t a = 0xcbf29ce484222325ull;
+		uint64_t b = 0x84222325cbf29ce4ull;
+		for(unsigned char c : data) {
+			a = (a ^ c) * 0x100000001b3ull;
+			b = (b ^ c) * 0x100000001b3ull;
+			b ^= b >> 29;
+		}
+		char res[33];
+		snprintf(res, sizeof(res), "%016llx%016llx", (unsigned long long)a, (unsigned long long)b);
+		return res;
+	}
+
+	fs::path DiskCache::getEntryFile(const std::string& key) const {
+		// spread entries over sub-directories to keep directories small
+		auto digest = getDigest(key);
+		return directory / digest.substr(0, 2) / digest.substr(2);
+	}
+
+	boost::optional<std::string> DiskCache::lookup(const std::string& key, const std::function<bool(const std::string&)>& isValid) {
+		std::ifstream in(getEntryFile(key).string(), std::ios::in | std::ios::binary);
+		if(in) {
+			// read the whole entry
+			std::stringstream buffer;
+			buffer << in.rdbuf();
+			std::string entry = buffer.str();
+
+			// the entry starts with the length of the key and the key itself
+			auto pos = entry.find('\n');
+			if(pos != std::string::npos) {
+				std::size_t length = std::stoull(entry.substr(0, pos));
+				if(pos + 1 + length <= entry.size() && entry.compare(pos + 1, length, key) == 0) {
+					std::string value = entry.substr(pos + 1 + length);
+					if(!isValid || isValid(value)) {
+						hits++;
+						return value;
+					}
+				}
+			}
+		}
+		misses++;
+		return boost::none;
+	}
+
+	void DiskCache::store(const std::string& key, const std::string& value) {
+		auto file = getEntryFile(key);
+		fs::create_directories(file.parent_path());
+
+		// write to a temporary file first, such that readers never observe partial entries
+		std::stringstream suffix;
+		suffix << ".tmp." << getpid() << "." << std::this_thread::get_id();
+		fs::path tmp = file.string() + suffix.str();
+		{
+			std::ofstream out(tmp.string(), std::ios::out | std::ios::binary);
+			out << key.length() << "\n" << key << value;
+			if(!out) {
+				boost::system::error_code ignored;
+				fs::remove(tmp, ignored);
+				return;
+			}
+		}
+		boost::system::error_code error;
+		fs::rename(tmp, file, error);
+		if(error) {
+			fs::remove(tmp, error);
+			return;
+		}
+		stores++;
+	}
+
+	std::ostream& DiskCache::printTo(std::ostream& out) const {
+		return out << "Cache " << directory.string() << ": " << hits << " hits, " << misses << " misses, " << stores << " stores";
+	}
+
+} // end namespace cache
+} // end namespace utils
+} // end namespace insieme
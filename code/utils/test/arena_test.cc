@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "insieme/utils/arena.h"
+
+namespace insieme {
+namespace utils {
+
+	TEST(Arena, Basic) {
+		Arena arena;
+		EXPECT_EQ(0u, arena.getAllocatedBytes());
+		EXPECT_EQ(0u, arena.getNumBlocks());
+
+		// allocate some memory
+		char* a = static_cast<char*>(arena.allocate(3, 1));
+		char* b = static_cast<char*>(arena.allocate(8, 8));
+
+		EXPECT_EQ(11u, arena.getAllocatedBytes());
+		EXPECT_EQ(1u, arena.getNumBlocks());
+
+		// check alignment and that allocations do not overlap
+		EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(b) % 8);
+		EXPECT_LE(a + 3, b);
+
+		// memory has to be usable
+		a[0] = a[1] = a[2] = 'x';
+		*reinterpret_cast<std::uint64_t*>(b) = 12;
+		EXPECT_EQ('x', a[2]);
+	}
+
+	TEST(Arena, Blocks) {
+		Arena arena;
+
+		// fill multiple blocks
+		for(int i = 0; i < 10000; i++) {
+			arena.allocate(32);
+		}
+		EXPECT_EQ(320000u, arena.getAllocatedBytes());
+		EXPECT_LT(1u, arena.getNumBlocks());
+		EXPECT_LE(arena.getAllocatedBytes(), arena.getReservedBytes());
+
+		// a large request gets its own block
+		auto blocks = arena.getNumBlocks();
+		arena.allocate(1024 * 1024);
+		EXPECT_EQ(blocks + 1, arena.getNumBlocks());
+	}
+
+	TEST(Arena, Concurrent) {
+		Arena arena;
+
+		const int numThreads = 8;
+		const int numAllocs = 10000;
+		std::vector<std::vector<void*>> results(numThreads);
+
+		std::vector<std::thread> threads;
+		for(int t = 0; t < numThreads; t++) {
+			threads.emplace_back([&, t]() {
+				for(int i = 0; i < numAllocs; i++) {
+					results[t].push_back(arena.allocate(16));
+				}
+			});
+		}
+		for(auto& cur : threads) {
+			cur.join();
+		}
+
+		// all allocations have to be distinct
+		std::set<void*> all;
+		for(const auto& cur : results) {
+			all.insert(cur.begin(), cur.end());
+		}
+		EXPECT_EQ(static_cast<std::size_t>(numThreads * numAllocs), all.size());
+		EXPECT_EQ(static_cast<std::size_t>(numThreads * numAllocs * 16), arena.getAllocatedBytes());
+	}
+
+} // end namespace utils
+} // end namespace insieme
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2002-2017 Distributed and Parallel Systems Group,
+ *                Institute of Computer Science,
+ *               University of Innsbruck, Austria
+ *
+ * This file is part of the INSIEME Compiler and Runtime System.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * If you require different license terms for your intended use of the
+ * software, e.g. for proprietary commercial or industrial use, please
+ * contact us at:
+ *                   insieme@dps.uibk.ac.at
+ *
+ * We kindly ask you to acknowledge the use of this software in any
+ * publication or other disclosure of results by referring to the
+ * following citation:
+ *
+ * H. Jordan, P. Thoman, J. Durillo, S. Pellegrini, P. Gschwandtner,
+ * T. Fahringer, H. Moritsch. A Multi-Objective Auto-Tuning Framework
+ * for Parallel Codes, in Proc. of the Intl. Conference for High
+ * Performance Computing, Networking, Storage and Analysis (SC 2012),
+ * IEEE Computer Society Press, Nov. 2012, Salt Lake City, USA.
+ */
+
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+
+#include "insieme/utils/disk_cache.h"
+#include "insieme/utils/string_utils.h"
+
+namespace insieme {
+namespace utils {
+namespace cache {
+
+	namespace fs = boost::filesystem;
+
+	TEST(DiskCache, StoreLookup) {
+		fs::path dir = fs::temp_directory_path() / fs::unique_path();
+		{
+			DiskCache cache(dir);
+			EXPECT_TRUE(fs::is_directory(dir));
+
+			EXPECT_FALSE(cache.lookup("a"));
+			cache.store("a", "value of a");
+			cache.store("b", std::string("binary\0data", 11));
+
+			EXPECT_EQ("value of a", *cache.lookup("a"));
+			EXPECT_EQ(std::string("binary\0data", 11), *cache.lookup("b"));
+
+			// override an entry
+			cache.store("a", "");
+			EXPECT_EQ("", *cache.lookup("a"));
+
+			// rejected entries are misses
+			EXPECT_FALSE(cache.lookup("b", [](const std::string&) { return false; }));
+
+			EXPECT_EQ(3u, cache.getNumHits());
+			EXPECT_EQ(2u, cache.getNumMisses());
+			EXPECT_EQ(3u, cache.getNumStores());
+			EXPECT_PRED2(containsSubString, toString(cache), "3 hits, 2 misses, 3 stores");
+		}
+
+		// entries persist across instances
+		{
+			DiskCache cache(dir);
+			EXPECT_EQ("", *cache.lookup("a"));
+			EXPECT_FALSE(cache.lookup("c"));
+		}
+
+		fs::remove_all(dir);
+	}
+
+	TEST(DiskCache, Digest) {
+		EXPECT_EQ(DiskCache::getDigest("abc"), DiskCache::getDigest("abc"));
+		EXPECT_NE(DiskCache::getDigest("abc"), DiskCache::getDigest("abd"));
+		EXPECT_EQ(32u, DiskCache::getDigest("").size());
+	}
+
+} // end namespace cache
+} // end namespace utils
+} // end namespace insieme
@@ -37,6 +37,7 @@
 
 #include <string>
 #include <iostream>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -115,6 +116,31 @@ TEST(InstanceManager, Basic) {
 }
 
 
+TEST(InstanceManager, PredicateLookup) {
+	CloneableStringManager base;
+	CloneableStringManager manager(base);
+
+	MyPtr a = base.get(CloneableString("A"));
+	MyPtr b = manager.get(CloneableString("B"));
+
+	// lookup elements without creating an instance
+	auto lookup = [&](const string& str) {
+		return manager.lookupPlain(boost::hash_value(str), [&](const CloneableString& cur) { return cur == str; });
+	};
+
+	EXPECT_EQ(&*a, lookup("A"));
+	EXPECT_EQ(&*b, lookup("B"));
+	EXPECT_FALSE(lookup("C"));
+
+	// the base manager does not know about the derived one
+	EXPECT_FALSE(base.lookupPlain(boost::hash_value(string("B")), [&](const CloneableString& cur) { return cur == "B"; }));
+
+	// nothing has been added
+	EXPECT_EQ(1u, base.size());
+	EXPECT_EQ(1u, manager.size());
+}
+
+
 TEST(InstanceManager, GetTests) {
 	// create a new instance manager
 	CloneableStringManager manager;
@@ -300,6 +326,41 @@ TEST(InstanceManager, IteratorTest) {
 	}
 }
 
+TEST(InstanceManager, ConcurrentAdd) {
+	CloneableStringManager manager;
+
+	const unsigned numThreads = 8;
+	const unsigned numElements = 1000;
+
+	// all threads are adding the same elements concurrently
+	vector<vector<MyPtr>> results(numThreads);
+	vector<std::thread> threads;
+	for(unsigned t = 0; t < numThreads; ++t) {
+		threads.emplace_back([&, t]() {
+			for(unsigned i = 0; i < numElements; ++i) {
+				results[t].push_back(manager.get(CloneableString(std::to_string(i))));
+			}
+		});
+	}
+	for(auto& cur : threads) {
+		cur.join();
+	}
+
+	// all of them have to obtain the same instances
+	EXPECT_EQ(numElements, manager.size());
+	for(unsigned t = 0; t < numThreads; ++t) {
+		ASSERT_EQ(numElements, results[t].size());
+		for(unsigned i = 0; i < numElements; ++i) {
+			EXPECT_EQ(&*results[0][i], &*results[t][i]);
+			EXPECT_TRUE(manager.addressesLocal(results[t][i]));
+		}
+	}
+
+	// and iterating has to enumerate each of them once
+	vector<MyPtr> list(manager.begin(), manager.end());
+	EXPECT_EQ(numElements, list.size());
+}
+
 TEST(InstanceManager, Chaining) {
 	// create a manager and a derived instance
 	CloneableStringManager managerA;